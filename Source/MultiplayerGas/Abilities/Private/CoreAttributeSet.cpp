@@ -704,7 +704,145 @@ void UCoreAttributeSet::UpdateTagBasedOnAttribute(const FGameplayAttribute& Attr
 	{
 		if (AIBaseCharacter* BaseOwningCharacter = Cast<AIBaseCharacter>(OwningActor))
 		{
-			FGameplayTagContainer GameplayTags = BaseOwningCharacter->CharacterTags;
+			const FGameplayTag Tag = FindDebuffTag(TagName);
+
+			if (!Tag.IsValid())
+			{
+				UE_LOG(TitansLog, Error, TEXT("UCoreAttributeSet::UpdateTagBasedOnAttribute - No Tag found for %s, abort."), *TagName.ToString());
+				return;
+			}
+
+			ApplyDebuffTag(BaseOwningCharacter->CharacterTags, Tag, Attribute, NewValue, BaseOwningCharacter->GetHealth());
+		}
+	}
+}
+
+void UCoreAttributeSet::InitDebuffTags()
+{
+	DebuffTags.Reset();
+
+	TArray<FName> DebuffNames = DebuffTagsToRemove;
+	for (const TPair<const FGameplayAttribute, FPOTAdjustCurrentAttribute>& Pair : GetDefault<UCoreAttributeSet>()->AdjustForCurrentAttributes)
+	{
+		if (Pair.Value.DebuffName)
+		{
+			DebuffNames.AddUnique(*Pair.Value.DebuffName);
+		}
+	}
+
+	for (const FName& Name : DebuffNames)
+	{
+		const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(Name, false);
+		if (Tag.IsValid())
+		{
+			DebuffTags.Add(Name, Tag);
+		}
+	}
+}
+
+FGameplayTag UCoreAttributeSet::FindDebuffTag(const FName& TagName)
+{
+	if (const FGameplayTag* CachedTag = DebuffTags.Find(TagName))
+	{
+		return *CachedTag;
+	}
+
+	// Not cached yet, either the table hasn't been built or the tag was registered late
+	const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(TagName);
+	if (Tag.IsValid())
+	{
+		DebuffTags.Add(TagName, Tag);
+	}
+
+	return Tag;
+}
+
+void UCoreAttributeSet::ApplyDebuffTag(FGameplayTagContainer& GameplayTags, const FGameplayTag& Tag, const FGameplayAttribute& Attribute, const float NewValue, const float CurrentHealth)
+{
+	if (Attribute == GetHealthAttribute())
+	{
+		// Debuff.Dead
+		if (NewValue <= 0 && !GameplayTags.HasTag(Tag))
+		{
+			GameplayTags.AddTagFast(Tag);
+			
+			//Also remove all debuff status tags since we have died
+			//@TODO Might want to remove buff as well
+			
+			for (const FName& Name : DebuffTagsToRemove)
+			{
+				const FGameplayTag TagToRemove = FindDebuffTag(Name);
+				if (TagToRemove.IsValid() && GameplayTags.HasTag(TagToRemove))
+				{
+					GameplayTags.RemoveTag(TagToRemove);
+				}
+			}
+		}
+		else if (NewValue > 0 && GameplayTags.HasTag(Tag))
+		{
+			GameplayTags.RemoveTag(Tag);
+		}
+	}
+	else if (Attribute.IsValid() && Tag.IsValid())
+	{
+		// These all apply a tag when their attribute is > 0 and remove when <= 0, so we can clump them together
+		if (NewValue > 0 && !GameplayTags.HasTag(Tag))
+		{
+			if (CurrentHealth > 0)
+			{
+				GameplayTags.AddTagFast(Tag);
+			}
+		}
+		else if (NewValue <= 0 && GameplayTags.HasTag(Tag))
+		{
+			GameplayTags.RemoveTag(Tag);
+		}
+	}
+}
+
+FString UCoreAttributeSet::BenchmarkDebuffTags(int32 NumSeconds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UCoreAttributeSet::BenchmarkDebuffTags"))
+
+	NumSeconds = FMath::Max(NumSeconds, 1);
+
+	constexpr int32 NumCharacters = 200;
+	constexpr int32 UpdatesPerSecond = 10;
+
+	// Every cached tag has to match what the tag manager hands out for the name
+	int32 NumTagMismatches = 0;
+	for (const TPair<FName, FGameplayTag>& Pair : DebuffTags)
+	{
+		if (Pair.Value != FGameplayTag::RequestGameplayTag(Pair.Key, false))
+		{
+			NumTagMismatches++;
+		}
+	}
+
+	struct FDebuffAttribute
+	{
+		FGameplayAttribute Attribute;
+		FName TagName;
+	};
+
+	TArray<FDebuffAttribute> DebuffAttributes;
+	for (const TPair<const FGameplayAttribute, FPOTAdjustCurrentAttribute>& Pair : GetDefault<UCoreAttributeSet>()->AdjustForCurrentAttributes)
+	{
+		if (Pair.Value.DebuffName && FindDebuffTag(*Pair.Value.DebuffName).IsValid())
+		{
+			DebuffAttributes.Add({ Pair.Key, *Pair.Value.DebuffName });
+		}
+	}
+
+	if (DebuffAttributes.IsEmpty())
+	{
+		return TEXT("DebuffTags: no debuff attributes with a valid tag");
+	}
+
+	// UpdateTagBasedOnAttribute as it was before the tags were cached, only the owning character's tags and health are passed in
+	const auto LegacyUpdateTagBasedOnAttribute = [](FGameplayTagContainer& CharacterTags, const float CurrentHealth, const FGameplayAttribute& Attribute, const float NewValue, const FName& TagName)
+	{
+			FGameplayTagContainer GameplayTags = CharacterTags;
 			const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(TagName);
 
 			if (!Tag.IsValid())
@@ -742,7 +880,7 @@ void UCoreAttributeSet::UpdateTagBasedOnAttribute(const FGameplayAttribute& Attr
 				// These all apply a tag when their attribute is > 0 and remove when <= 0, so we can clump them together
 				if (NewValue > 0 && !GameplayTags.HasTag(Tag))
 				{
-					if (BaseOwningCharacter->GetHealth() > 0)
+					if (CurrentHealth > 0)
 					{
 						GameplayTags.AddTagFast(Tag);
 					}
@@ -753,9 +891,59 @@ void UCoreAttributeSet::UpdateTagBasedOnAttribute(const FGameplayAttribute& Attr
 				}
 			}
 
-			BaseOwningCharacter->CharacterTags = GameplayTags;
+			CharacterTags = GameplayTags;
+	};
+
+	TArray<FGameplayTagContainer> LegacyTags;
+	TArray<FGameplayTagContainer> CachedTags;
+	LegacyTags.SetNum(NumCharacters);
+	CachedTags.SetNum(NumCharacters);
+
+	// Both passes replay the same attribute changes, mostly rates ticking down with the odd fresh debuff or death
+	const auto RunPass = [&](TArray<FGameplayTagContainer>& Containers, const bool bLegacy)
+	{
+		FRandomStream RandomStream(NumCharacters);
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Update = 0; Update < NumSeconds * UpdatesPerSecond; Update++)
+		{
+			for (FGameplayTagContainer& CharacterTags : Containers)
+			{
+				const FDebuffAttribute& DebuffAttribute = DebuffAttributes[RandomStream.RandHelper(DebuffAttributes.Num())];
+				const float NewValue = RandomStream.FRand() < 0.3f ? 0.f : RandomStream.FRandRange(0.f, 10.f);
+				const float CurrentHealth = RandomStream.FRand() < 0.01f ? 0.f : 100.f;
+
+				if (bLegacy)
+				{
+					LegacyUpdateTagBasedOnAttribute(CharacterTags, CurrentHealth, DebuffAttribute.Attribute, NewValue, DebuffAttribute.TagName);
+				}
+				else
+				{
+					ApplyDebuffTag(CharacterTags, FindDebuffTag(DebuffAttribute.TagName), DebuffAttribute.Attribute, NewValue, CurrentHealth);
+				}
+			}
+		}
+		return FPlatformTime::Seconds() - Start;
+	};
+
+	const double LegacySeconds = RunPass(LegacyTags, true);
+	const double CachedSeconds = RunPass(CachedTags, false);
+
+	int32 NumStateMismatches = 0;
+	for (int32 Index = 0; Index < NumCharacters; Index++)
+	{
+		if (!LegacyTags[Index].HasAllExact(CachedTags[Index]) || !CachedTags[Index].HasAllExact(LegacyTags[Index]))
+		{
+			NumStateMismatches++;
 		}
 	}
+
+	const int64 NumUpdates = int64(NumCharacters) * UpdatesPerSecond * NumSeconds;
+	const FString Summary = FString::Printf(TEXT("DebuffTags: %d characters x %d updates/s, %d seconds, %lld updates. ByName: %.3fms Cached: %.3fms Mismatches: %d tags %d characters"),
+		NumCharacters, UpdatesPerSecond, NumSeconds, NumUpdates, LegacySeconds * 1000.0, CachedSeconds * 1000.0, NumTagMismatches, NumStateMismatches);
+
+	UE_LOG(TitansLog, Log, TEXT("UCoreAttributeSet::BenchmarkDebuffTags: %s"), *Summary);
+
+	return Summary;
 }
 
 void UCoreAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
@@ -1251,6 +1439,96 @@ void UCoreAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
 	DOREPLIFETIME_WITH_PARAMS_FAST(UCoreAttributeSet, LegHealRate, CustomParams);
 }
 
+#define POT_CONDITIONAL_REP_ATTRIBUTE(PropName) \
+	{ GET_MEMBER_NAME_CHECKED(UCoreAttributeSet, PropName), (int32)UCoreAttributeSet::ENetFields_Private::PropName, &UCoreAttributeSet::bCondRepActive_##PropName }
+
+const UCoreAttributeSet::FConditionalRepTable& UCoreAttributeSet::GetConditionalRepTable()
+{
+	static const FConditionalRepTable Table = []()
+	{
+		FConditionalRepTable Result;
+		Result.Attributes = {
+			POT_CONDITIONAL_REP_ATTRIBUTE(MaxHealth),
+			POT_CONDITIONAL_REP_ATTRIBUTE(HealthRecoveryRate),
+			POT_CONDITIONAL_REP_ATTRIBUTE(HealthRecoveryMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(MaxStamina),
+			POT_CONDITIONAL_REP_ATTRIBUTE(StaminaRecoveryRate),
+			POT_CONDITIONAL_REP_ATTRIBUTE(StaminaRecoveryMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(CombatWeight),
+			POT_CONDITIONAL_REP_ATTRIBUTE(Armor),
+			POT_CONDITIONAL_REP_ATTRIBUTE(MovementSpeedMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(TurnRadiusMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(TurnInPlaceRadiusMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(SprintingSpeedMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(TrottingSpeedMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(JumpForceMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(AirControlMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(BodyFoodAmount),
+			POT_CONDITIONAL_REP_ATTRIBUTE(BodyFoodCorpseThreshold),
+			POT_CONDITIONAL_REP_ATTRIBUTE(MaxHunger),
+			POT_CONDITIONAL_REP_ATTRIBUTE(HungerDepletionRate),
+			POT_CONDITIONAL_REP_ATTRIBUTE(FoodConsumptionRate),
+			POT_CONDITIONAL_REP_ATTRIBUTE(MaxThirst),
+			POT_CONDITIONAL_REP_ATTRIBUTE(ThirstDepletionRate),
+			POT_CONDITIONAL_REP_ATTRIBUTE(ThirstReplenishRate),
+			POT_CONDITIONAL_REP_ATTRIBUTE(WaterConsumptionRate),
+			POT_CONDITIONAL_REP_ATTRIBUTE(MaxOxygen),
+			POT_CONDITIONAL_REP_ATTRIBUTE(OxygenDepletionRate),
+			POT_CONDITIONAL_REP_ATTRIBUTE(OxygenRecoveryRate),
+			POT_CONDITIONAL_REP_ATTRIBUTE(FallDeathSpeed),
+			POT_CONDITIONAL_REP_ATTRIBUTE(FallingLegDamage),
+			POT_CONDITIONAL_REP_ATTRIBUTE(LimpHealthThreshold),
+			POT_CONDITIONAL_REP_ATTRIBUTE(KnockbackToDelatchThreshold),
+			POT_CONDITIONAL_REP_ATTRIBUTE(KnockbackToDecarryThreshold),
+			POT_CONDITIONAL_REP_ATTRIBUTE(KnockbackToCancelAttackThreshold),
+			POT_CONDITIONAL_REP_ATTRIBUTE(CarryCapacity),
+			POT_CONDITIONAL_REP_ATTRIBUTE(HungerDamage),
+			POT_CONDITIONAL_REP_ATTRIBUTE(ThirstDamage),
+			POT_CONDITIONAL_REP_ATTRIBUTE(OxygenDamage),
+			POT_CONDITIONAL_REP_ATTRIBUTE(GrowthPerSecond),
+			POT_CONDITIONAL_REP_ATTRIBUTE(GrowthPerSecondMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(WaterVision),
+			POT_CONDITIONAL_REP_ATTRIBUTE(WetnessDurationMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(BuffDurationMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(SpikeDamageMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(KnockbackMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(GroundAccelerationMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(GroundPreciseAccelerationMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(KnockbackTractionMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(SwimmingAccelerationMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(StaminaJumpCostMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(StaminaSprintCostMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(StaminaSwimCostMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(StaminaTrotSwimCostMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(StaminaFastSwimCostMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(StaminaDiveCostMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(StaminaTrotDiveCostMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(StaminaFastDiveCostMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(StaminaFlyCostMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(StaminaFastFlyCostMultiplier),
+			POT_CONDITIONAL_REP_ATTRIBUTE(CooldownDurationMultiplier),
+
+			// STATUS_UPDATE_MARKER - Conditional replication
+			POT_CONDITIONAL_REP_ATTRIBUTE(BleedingHealRate),
+			POT_CONDITIONAL_REP_ATTRIBUTE(PoisonHealRate),
+			POT_CONDITIONAL_REP_ATTRIBUTE(VenomHealRate),
+			POT_CONDITIONAL_REP_ATTRIBUTE(LegHealRate),
+			POT_CONDITIONAL_REP_ATTRIBUTE(Wetness),
+		};
+
+		for (int32 Ordinal = 0; Ordinal < Result.Attributes.Num(); Ordinal++)
+		{
+			Result.OrdinalByName.Add(Result.Attributes[Ordinal].AttributeName, Ordinal);
+		}
+
+		return Result;
+	}();
+
+	return Table;
+}
+
+#undef POT_CONDITIONAL_REP_ATTRIBUTE
+
 void UCoreAttributeSet::PreReplicate()
 {
 	if (!bHasDirtyConditionalProperty && bHasDoneInitialReplication)
@@ -1276,82 +1554,34 @@ void UCoreAttributeSet::PreReplicate()
 	}
 	// Need the reference for 5.3's API
 	FRepChangedPropertyTracker& ChangedPropertyTracker = *ChangedPropertyTrackerPtr;
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, MaxHealth);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, HealthRecoveryRate);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, HealthRecoveryMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, MaxStamina);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, StaminaRecoveryRate);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, StaminaRecoveryMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, CombatWeight);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, Armor);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, MovementSpeedMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, TurnRadiusMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, TurnInPlaceRadiusMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, SprintingSpeedMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, TrottingSpeedMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, JumpForceMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, AirControlMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, BodyFoodAmount);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, BodyFoodCorpseThreshold);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, MaxHunger);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, HungerDepletionRate);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, FoodConsumptionRate);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, MaxThirst);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, ThirstDepletionRate);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, ThirstReplenishRate);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, WaterConsumptionRate);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, MaxOxygen);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, OxygenDepletionRate);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, OxygenRecoveryRate);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, FallDeathSpeed);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, FallingLegDamage);
-	
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, LimpHealthThreshold);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, KnockbackToDelatchThreshold);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, KnockbackToDecarryThreshold);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, KnockbackToCancelAttackThreshold);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, CarryCapacity);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, HungerDamage);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, ThirstDamage);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, OxygenDamage);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, GrowthPerSecond);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, GrowthPerSecondMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, WaterVision);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, WetnessDurationMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, BuffDurationMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, SpikeDamageMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, KnockbackMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, GroundAccelerationMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, GroundPreciseAccelerationMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, KnockbackTractionMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, SwimmingAccelerationMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, StaminaJumpCostMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, StaminaSprintCostMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, StaminaSwimCostMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, StaminaTrotSwimCostMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, StaminaFastSwimCostMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, StaminaDiveCostMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, StaminaTrotDiveCostMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, StaminaFastDiveCostMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, StaminaFlyCostMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, StaminaFastFlyCostMultiplier);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, CooldownDurationMultiplier);
 
-	// STATUS_UPDATE_MARKER - DOREPLIFETIME
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, BleedingHealRate);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, PoisonHealRate);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, VenomHealRate);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, LegHealRate);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(this, UCoreAttributeSet, Wetness);
+	const TArray<FConditionalRepAttribute>& ConditionalAttributes = GetConditionalRepTable().Attributes;
 
 	if (!bHasDoneInitialReplication)
 	{
+		// Everything replicates once so clients start with the full set, the flags apply from the next pass
+		for (const FConditionalRepAttribute& ConditionalAttribute : ConditionalAttributes)
+		{
+			UE::Net::Private::FNetPropertyConditionManager::SetPropertyActiveOverride(ChangedPropertyTracker, this, ConditionalAttribute.RepIndex, true);
+		}
+
+		AppliedConditionalRep.Init(true, ConditionalAttributes.Num());
 		bHasDoneInitialReplication = true;
+		return;
 	}
-	else
+
+	// Only attributes whose flag changed since the last pass touch the tracker
+	for (int32 Ordinal = 0; Ordinal < ConditionalAttributes.Num(); Ordinal++)
 	{
-		bHasDirtyConditionalProperty = false;
+		const bool bActive = this->*ConditionalAttributes[Ordinal].bActive;
+		if (AppliedConditionalRep[Ordinal] != bActive)
+		{
+			UE::Net::Private::FNetPropertyConditionManager::SetPropertyActiveOverride(ChangedPropertyTracker, this, ConditionalAttributes[Ordinal].RepIndex, bActive);
+			AppliedConditionalRep[Ordinal] = bActive;
+		}
 	}
+
+	bHasDirtyConditionalProperty = false;
 }
 
 void UCoreAttributeSet::PostInitProperties()
@@ -1375,26 +1605,13 @@ void UCoreAttributeSet::PostInitProperties()
 
 void UCoreAttributeSet::SetConditionalAttributeReplication(const FString& AttributeName, bool bEnabled)
 {
-	const FString FuncName = FString::Printf(TEXT("CondRep_%s"), *AttributeName);
-	UFunction* const ConditionalReplicator = FindUField<UFunction>(UCoreAttributeSet::StaticClass(), *FuncName);
-	if (!ConditionalReplicator)
+	const FConditionalRepTable& ConditionalRepTable = GetConditionalRepTable();
+	const int32* const Ordinal = ConditionalRepTable.OrdinalByName.Find(FName(*AttributeName, FNAME_Find));
+	if (!Ordinal)
 	{
 		return;
 	}
-	uint8* const Buffer = (uint8*)FMemory_Alloca(ConditionalReplicator->ParmsSize);
-	FMemory::Memzero(Buffer, ConditionalReplicator->ParmsSize);
-
-	for (TFieldIterator<FProperty> It(ConditionalReplicator); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
-	{
-		const FProperty* const FunctionProperty = *It;
-		const FString Type = FunctionProperty->GetCPPType();
-
-		if (Type == TEXT("bool"))
-		{
-			*FunctionProperty->ContainerPtrToValuePtr<bool>(Buffer) = bEnabled;
-			break;
-		}
-	}
 
-	ProcessEvent(ConditionalReplicator, Buffer);
+	this->*ConditionalRepTable.Attributes[*Ordinal].bActive = bEnabled;
+	bHasDirtyConditionalProperty = true;
 }
@@ -60,6 +60,21 @@ void UPOTAbilitySystemComponent::InitializeAbilitySystem(AActor* InOwnerActor, A
 
 	OnActiveGameplayEffectAddedDelegateToSelf.AddUObject(this, &UPOTAbilitySystemComponent::OnActiveGameplayEffectAddedCallback);
 	ActiveGameplayEffects.OnActiveGameplayEffectRemovedDelegate.AddUObject(this, &UPOTAbilitySystemComponent::RemoveBoneDamageMultipliersOnEffectRemoved);
+	ActiveGameplayEffects.OnActiveGameplayEffectRemovedDelegate.AddUObject(this, &UPOTAbilitySystemComponent::UnindexReEvalEffect);
+
+	if (!bReEvalEffectsIndexed)
+	{
+		// Effects applied before we started listening for adds
+		ReEvalEffectHandles.Reset();
+		for (const FActiveGameplayEffectHandle& ActiveHandle : ActiveGameplayEffects.GetAllActiveEffectHandles())
+		{
+			if (const FActiveGameplayEffect* Effect = ActiveGameplayEffects.GetActiveGameplayEffect(ActiveHandle))
+			{
+				IndexReEvalEffect(*Effect);
+			}
+		}
+		bReEvalEffectsIndexed = true;
+	}
 
 	InAvatarActor->GetWorldTimerManager().SetTimer(LocomotionUpdateTimerHandle, this, &UPOTAbilitySystemComponent::UpdateLocomotionEffects, LocomotionStateUpdateRate, true);
 
@@ -213,6 +228,8 @@ void UPOTAbilitySystemComponent::OnActiveGameplayEffectAddedCallback(UAbilitySys
 		return;
 	}
 
+	IndexReEvalEffect(*ActiveGameplayEffect);
+
 	FGameplayTag BuffTag = FGameplayTag::RequestGameplayTag(NAME_Buff);
 	bool ContainsBuffTag = ActiveGameplayEffect->Spec.Def->GetAssetTags().HasTag(BuffTag);
 
@@ -1101,6 +1118,14 @@ void UPOTAbilitySystemComponent::OnGrowthChanged(const FOnAttributeChangeData& C
 	{
 		InitAttributes(false);
 
+		// Capsules scale with growth, sweep results cached at the old size no longer apply
+		if (const ACharacter* const Character = Cast<ACharacter>(GetOwner()))
+		{
+			if (UICharacterMovementComponent* const CharMove = Cast<UICharacterMovementComponent>(Character->GetCharacterMovement()))
+			{
+				CharMove->InvalidateCachedHits();
+			}
+		}
 	}
 }
 
@@ -1668,16 +1693,105 @@ UPOTGameplayAbility* UPOTAbilitySystemComponent::GetActiveAbilityFromSpec(const
 	return nullptr;
 }
 
+// ReEval.Attribute.<Attribute> tag for an attribute, invalid if no effect can be tagged with it
+static FGameplayTag GetReEvalTagForAttribute(const FGameplayAttribute& Attribute)
+{
+	static TMap<FGameplayAttribute, FGameplayTag> ReEvalTags;
+
+	if (const FGameplayTag* CachedTag = ReEvalTags.Find(Attribute))
+	{
+		return *CachedTag;
+	}
+
+	const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName("ReEval.Attribute." + Attribute.GetName()), false);
+	if (Tag.IsValid())
+	{
+		ReEvalTags.Add(Attribute, Tag);
+	}
+
+	return Tag;
+}
+
 void UPOTAbilitySystemComponent::ReevaluateEffectsBasedOnAttribute(FGameplayAttribute Attribute, float NewLevel)
 {
-	TArray<FActiveGameplayEffectHandle> Handles = ActiveGameplayEffects.GetAllActiveEffectHandles();
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UPOTAbilitySystemComponent::ReevaluateEffectsBasedOnAttribute"))
+
+	const FGameplayTag ReEvalTag = GetReEvalTagForAttribute(Attribute);
+	if (!ReEvalTag.IsValid())
+	{
+		return;
+	}
+
+	if (!bReEvalEffectsIndexed)
+	{
+		TArray<FActiveGameplayEffectHandle> Handles = ActiveGameplayEffects.GetAllActiveEffectHandles();
+		for (const FActiveGameplayEffectHandle ActiveHandle : Handles)
+		{
+			if (const FActiveGameplayEffect* Effect = ActiveGameplayEffects.GetActiveGameplayEffect(ActiveHandle) )
+			{
+				if (Effect->Spec.Def->GetAssetTags().HasTagExact(ReEvalTag))
+				{
+					ActiveGameplayEffects.SetActiveGameplayEffectLevel(ActiveHandle, NewLevel);
+				}
+			}
+		}
+		return;
+	}
+
+	const TArray<FActiveGameplayEffectHandle>* IndexedHandles = ReEvalEffectHandles.Find(ReEvalTag);
+	if (!IndexedHandles)
+	{
+		return;
+	}
+
+	// Copied since changing the level can remove effects
+	const TArray<FActiveGameplayEffectHandle> Handles = *IndexedHandles;
 	for (const FActiveGameplayEffectHandle ActiveHandle : Handles)
 	{
-		if (const FActiveGameplayEffect* Effect = ActiveGameplayEffects.GetActiveGameplayEffect(ActiveHandle) )
+		if (ActiveGameplayEffects.GetActiveGameplayEffect(ActiveHandle))
+		{
+			ActiveGameplayEffects.SetActiveGameplayEffectLevel(ActiveHandle, NewLevel);
+		}
+	}
+}
+
+void UPOTAbilitySystemComponent::IndexReEvalEffect(const FActiveGameplayEffect& Effect)
+{
+	if (!Effect.Spec.Def)
+	{
+		return;
+	}
+
+	static const FGameplayTag ReEvalAttributeTag = FGameplayTag::RequestGameplayTag(FName("ReEval.Attribute"), false);
+	if (!ReEvalAttributeTag.IsValid())
+	{
+		return;
+	}
+
+	for (const FGameplayTag& Tag : Effect.Spec.Def->GetAssetTags())
+	{
+		if (Tag != ReEvalAttributeTag && Tag.MatchesTag(ReEvalAttributeTag))
+		{
+			ReEvalEffectHandles.FindOrAdd(Tag).AddUnique(Effect.Handle);
+		}
+	}
+}
+
+void UPOTAbilitySystemComponent::UnindexReEvalEffect(const FActiveGameplayEffect& RemovedEffect)
+{
+	if (!RemovedEffect.Spec.Def)
+	{
+		return;
+	}
+
+	for (const FGameplayTag& Tag : RemovedEffect.Spec.Def->GetAssetTags())
+	{
+		if (TArray<FActiveGameplayEffectHandle>* Handles = ReEvalEffectHandles.Find(Tag))
 		{
-			if (Effect->Spec.Def->GetAssetTags().HasTagExact(FGameplayTag::RequestGameplayTag(FName("ReEval.Attribute." + Attribute.GetName()))))
+			Handles->RemoveSingleSwap(RemovedEffect.Handle);
+			if (Handles->IsEmpty())
 			{
-				ActiveGameplayEffects.SetActiveGameplayEffectLevel(ActiveHandle, NewLevel);
+				ReEvalEffectHandles.Remove(Tag);
 			}
 		}
 	}
@@ -7,6 +7,7 @@
 #include "GameplayEffectTypes.h"
 #include "GameplayEffectUIData.h"
 #include "Abilities/POTAttributeSetInitter.h"
+#include "Abilities/CoreAttributeSet.h"
 #include "TitanAssetManager.h"
 #include "ITypes.h"
 #include "Player/IBaseCharacter.h"
@@ -65,6 +66,8 @@ void UPOTAbilitySystemGlobals::InitGlobalData()
 	ensureMsgf(WaystoneInviteChargingGameplayEffect != nullptr, TEXT("Ability config value WaystoneInviteChargingGameplayEffectName is not a valid class name."));
 
 	IAlderonDatabase::SetCustomEffectFilterFunction(&UPOTAbilitySystemGlobals::ShouldFilterEffect);
+
+	UCoreAttributeSet::InitDebuffTags();
 }
 
 void UPOTAbilitySystemGlobals::ReloadAttributeDefaults()
@@ -21,17 +21,147 @@ TSubclassOf<UAttributeSet> FPOTAttributeSetInitter::FindBestAttributeClass(TArra
 void FPOTAttributeSetInitter::PreloadAttributeSetData(const TArray<UCurveTable*>& CurveData)
 {
 	PreloadCurveData(CurveData, Defaults);
+	BakeDefaults();
 }
 
 void FPOTAttributeSetInitter::PreloadModAttributeSetData(const TArray<UCurveTable*>& CurveData)
 {
 	ModDefaults.Empty();
 	PreloadCurveData(CurveData, ModDefaults);
+	BakeDefaults();
 }
 
 void FPOTAttributeSetInitter::PreloadAttributeSetDataFromCSV(const FString& CSV)
 {
 	PreloadCurveDataFromCSV(CSV, Defaults);
+	BakeDefaults();
+}
+
+void FPOTAttributeSetInitter::BakeDefaults()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FPOTAttributeSetInitter::BakeDefaults"))
+
+	BakedDefaults.Reset();
+
+	TArray<FName> GroupNames;
+	Defaults.GetKeys(GroupNames);
+	for (const TPair<FName, FPOTAttributeSetDefaultsCollection>& ModPair : ModDefaults)
+	{
+		GroupNames.AddUnique(ModPair.Key);
+	}
+
+	for (const FName& GroupName : GroupNames)
+	{
+		const FPOTAttributeSetDefaultsCollection* ModCollection = ModDefaults.Find(GroupName);
+		const FPOTAttributeSetDefaultsCollection* Collection = Defaults.Find(GroupName);
+		if (!Collection)
+		{
+			// Groups only added by mods use the mod tables as their defaults
+			Collection = ModCollection;
+		}
+
+		// Attribute sets and their attributes in the order the curve tables listed them, mods can add attributes to a set
+		TArray<TSubclassOf<UAttributeSet>> SetClasses;
+		TArray<TArray<FProperty*>> SetProperties;
+
+		const auto GatherProperties = [&SetClasses, &SetProperties](const FPOTAttributeSetDefaultsCollection& Source, bool bAddSets)
+		{
+			for (const FPOTAttributeSetDefaults& LevelDefaults : Source.LevelData)
+			{
+				for (const TPair<TSubclassOf<UAttributeSet>, FPOTAttributeDefaultValueList>& SetPair : LevelDefaults.DataMap)
+				{
+					int32 SetIndex = SetClasses.IndexOfByKey(SetPair.Key);
+					if (SetIndex == INDEX_NONE)
+					{
+						if (!bAddSets)
+						{
+							continue;
+						}
+
+						SetIndex = SetClasses.Add(SetPair.Key);
+						SetProperties.AddDefaulted();
+					}
+
+					for (const FPOTAttributeDefaultValueList::FOffsetValuePair& Pair : SetPair.Value.List)
+					{
+						SetProperties[SetIndex].AddUnique(Pair.Property);
+					}
+				}
+			}
+		};
+
+		GatherProperties(*Collection, true);
+		if (ModCollection && ModCollection != Collection)
+		{
+			GatherProperties(*ModCollection, false);
+		}
+
+		FPOTBakedAttributeDefaults& Baked = BakedDefaults.Add(GroupName);
+		Baked.NumLevels = Collection->LevelData.Num();
+
+		for (int32 SetIndex = 0; SetIndex < SetClasses.Num(); SetIndex++)
+		{
+			FPOTBakedAttributeDefaults::FSetRange& Range = Baked.Sets.AddDefaulted_GetRef();
+			Range.SetClass = SetClasses[SetIndex];
+			Range.FirstOrdinal = Baked.Properties.Num();
+			Range.NumAttributes = SetProperties[SetIndex].Num();
+			Baked.Properties.Append(SetProperties[SetIndex]);
+		}
+
+		const int32 NumAttributes = Baked.Properties.Num();
+		Baked.Values.Init(std::numeric_limits<float>::quiet_NaN(), Baked.NumLevels * NumAttributes);
+
+		const auto WriteLevel = [&Baked, NumAttributes](const FPOTAttributeSetDefaults& LevelDefaults, int32 LevelIndex)
+		{
+			for (const FPOTBakedAttributeDefaults::FSetRange& Range : Baked.Sets)
+			{
+				const FPOTAttributeDefaultValueList* DataList = LevelDefaults.DataMap.Find(Range.SetClass);
+				if (!DataList)
+				{
+					continue;
+				}
+
+				for (const FPOTAttributeDefaultValueList::FOffsetValuePair& Pair : DataList->List)
+				{
+					for (int32 Ordinal = Range.FirstOrdinal; Ordinal < Range.FirstOrdinal + Range.NumAttributes; Ordinal++)
+					{
+						if (Baked.Properties[Ordinal] == Pair.Property)
+						{
+							Baked.Values[LevelIndex * NumAttributes + Ordinal] = Pair.Value;
+							break;
+						}
+					}
+				}
+			}
+		};
+
+		for (int32 LevelIndex = 0; LevelIndex < Baked.NumLevels; LevelIndex++)
+		{
+			WriteLevel(Collection->LevelData[LevelIndex], LevelIndex);
+
+			if (ModCollection && ModCollection != Collection && ModCollection->LevelData.IsValidIndex(LevelIndex))
+			{
+				WriteLevel(ModCollection->LevelData[LevelIndex], LevelIndex);
+			}
+		}
+	}
+}
+
+const FPOTAttributeSetInitter::FPOTBakedAttributeDefaults* FPOTAttributeSetInitter::FindBakedDefaults(FName GroupName) const
+{
+	if (const FPOTBakedAttributeDefaults* Baked = BakedDefaults.Find(GroupName))
+	{
+		return Baked;
+	}
+
+	ABILITY_LOG(Warning, TEXT("Unable to find DefaultAttributeSet Group %s. Falling back to Defaults"), *GroupName.ToString());
+	const FPOTBakedAttributeDefaults* Baked = BakedDefaults.Find(FName(TEXT("Default")));
+	if (!Baked)
+	{
+		ABILITY_LOG(Error, TEXT("FAttributeSetInitterDiscreteLevels::InitAttributeSetDefaults Default DefaultAttributeSet not found! Skipping Initialization"));
+	}
+
+	return Baked;
 }
 
 void FPOTAttributeSetInitter::InitAttributeSetDefaults(UAbilitySystemComponent* AbilitySystemComponent, FName GroupName, int32 Level, bool bInitialInit) const
@@ -417,44 +547,41 @@ bool FPOTAttributeSetInitter::PreloadRow(const FString& RowName, const FString&
 
 void FPOTAttributeSetInitter::InitAttributeSetDefaultsGradient(UAbilitySystemComponent* AbilitySystemComponent, FName GroupName, float Level, bool bInitialInit) const
 {
-	check(AbilitySystemComponent != nullptr);
-
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FPOTAttributeSetInitter::InitAttributeSetDefaultsGradient"))
 
-	const FPOTAttributeSetDefaultsCollection* Collection = Defaults.Find(GroupName);
-	const FPOTAttributeSetDefaultsCollection* ModCollection = ModDefaults.Find(GroupName);
+	check(AbilitySystemComponent != nullptr);
 
-	if (!Collection)
+	const FPOTBakedAttributeDefaults* Baked = FindBakedDefaults(GroupName);
+	if (!Baked)
 	{
-		if (ModCollection)
-		{
-			Collection = ModCollection;
-		}
-		else
-		{
-			ABILITY_LOG(Warning, TEXT("Unable to find DefaultAttributeSet Group %s. Falling back to Defaults"), *GroupName.ToString());
-			Collection = Defaults.Find(FName(TEXT("Default")));
-			if (!Collection)
-			{
-				ABILITY_LOG(Error, TEXT("FAttributeSetInitterDiscreteLevels::InitAttributeSetDefaults Default DefaultAttributeSet not found! Skipping Initialization"));
-				return;
-			}
-		}
-		
+		return;
 	}
 
 	int32 BottomLevel = FMath::FloorToInt(Level);
 	int32 TopLevel = FMath::CeilToInt(Level);
 
-	if (!Collection->LevelData.IsValidIndex(BottomLevel - 1) || !Collection->LevelData.IsValidIndex(TopLevel - 1))
+	if (BottomLevel < 1 || TopLevel > Baked->NumLevels)
 	{
 		// We could eventually extrapolate values outside of the max defined levels
-		ABILITY_LOG(Warning, TEXT("Attribute defaults for Level %d are not defined! Skipping"), Level);
+		ABILITY_LOG(Warning, TEXT("Attribute defaults for Level %f are not defined! Skipping"), Level);
 		return;
 	}
 
-	const FPOTAttributeSetDefaults& BottomSetDefaults = Collection->LevelData[BottomLevel - 1];
-	const FPOTAttributeSetDefaults& TopSetDefaults = Collection->LevelData[TopLevel - 1];
+	// Lerp the whole row up front, both rows are contiguous so this vectorizes
+	const int32 NumAttributes = Baked->Properties.Num();
+	const float* BottomRow = Baked->GetLevelRow(BottomLevel);
+	const float* TopRow = Baked->GetLevelRow(TopLevel);
+	const float Alpha = FMath::Frac(Level);
 
+	TArray<float, TInlineAllocator<256>> GradientValues;
+	GradientValues.SetNumUninitialized(NumAttributes);
+	float* GradientData = GradientValues.GetData();
+	for (int32 Ordinal = 0; Ordinal < NumAttributes; Ordinal++)
+	{
+		GradientData[Ordinal] = FMath::Lerp(BottomRow[Ordinal], TopRow[Ordinal], Alpha);
+	}
+
+	bool bAnyChanged = false;
 	for (const UAttributeSet* Set : AbilitySystemComponent->GetSpawnedAttributes()) // this might need to be GetSpawnedAttributes_Mutable
 	{
 		if (!Set)
@@ -462,53 +589,202 @@ void FPOTAttributeSetInitter::InitAttributeSetDefaultsGradient(UAbilitySystemCom
 			continue;
 		}
 
-		const FPOTAttributeDefaultValueList* DefaultDataList = BottomSetDefaults.DataMap.Find(Set->GetClass());
-		const FPOTAttributeDefaultValueList* TopDefaultDataList = TopSetDefaults.DataMap.Find(Set->GetClass());
+		const FPOTBakedAttributeDefaults::FSetRange* Range = Baked->FindSet(Set->GetClass());
+		if (!Range)
+		{
+			continue;
+		}
 
-		const FPOTAttributeDefaultValueList* ModDefaultDataList = nullptr;
-		const FPOTAttributeDefaultValueList* ModTopDefaultDataList = nullptr;
+		ABILITY_LOG(Log, TEXT("Initializing Set %s"), *Set->GetName());
 
-		if (ModCollection != nullptr && ModCollection->LevelData.IsValidIndex(BottomLevel - 1) && ModCollection->LevelData.IsValidIndex(TopLevel - 1))
+		for (int32 Ordinal = Range->FirstOrdinal; Ordinal < Range->FirstOrdinal + Range->NumAttributes; Ordinal++)
 		{
-			const FPOTAttributeSetDefaults& ModBottomSetDefaults = ModCollection->LevelData[BottomLevel - 1];
-			const FPOTAttributeSetDefaults& ModTopSetDefaults = ModCollection->LevelData[TopLevel - 1];
+			const float ActualValue = GradientData[Ordinal];
+			if (FMath::IsNaN(ActualValue))
+			{
+				continue;
+			}
 
-			ModDefaultDataList = ModBottomSetDefaults.DataMap.Find(Set->GetClass());
-			ModTopDefaultDataList = ModTopSetDefaults.DataMap.Find(Set->GetClass());
+			FProperty* const Property = Baked->Properties[Ordinal];
+			if (Set->ShouldInitProperty(bInitialInit, Property))
+			{
+				FGameplayAttribute AttributeToModify(Property);
+				if (AbilitySystemComponent->GetNumericAttributeBase(AttributeToModify) != ActualValue)
+				{
+					AbilitySystemComponent->SetNumericAttributeBase(AttributeToModify, ActualValue);
+					bAnyChanged = true;
+				}
+			}
 		}
+	}
 
-		if (DefaultDataList && TopDefaultDataList)
+	// Growth ticks often land on the same values, don't force a net update for nothing
+	if (bAnyChanged)
+	{
+		AbilitySystemComponent->ForceReplication();
+	}
+}
+
+FString FPOTAttributeSetInitter::BenchmarkGradientDefaults(int32 NumCharacters) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FPOTAttributeSetInitter::BenchmarkGradientDefaults"))
+
+	NumCharacters = FMath::Max(NumCharacters, 1);
+
+	TArray<FName> GroupNames;
+	for (const TPair<FName, FPOTBakedAttributeDefaults>& Pair : BakedDefaults)
+	{
+		if (Pair.Value.NumLevels > 0)
 		{
-			ABILITY_LOG(Log, TEXT("Initializing Set %s"), *Set->GetName());
+			GroupNames.Add(Pair.Key);
+		}
+	}
+
+	if (GroupNames.IsEmpty())
+	{
+		return TEXT("GradientDefaults: no attribute defaults loaded");
+	}
+
+	struct FBenchmarkCharacter
+	{
+		FName GroupName;
+		float Level = 1.f;
+	};
+
+	FRandomStream RandomStream(NumCharacters);
+	TArray<FBenchmarkCharacter> Characters;
+	Characters.Reserve(NumCharacters);
+	for (int32 Index = 0; Index < NumCharacters; Index++)
+	{
+		FBenchmarkCharacter& Character = Characters.AddDefaulted_GetRef();
+		Character.GroupName = GroupNames[RandomStream.RandHelper(GroupNames.Num())];
+		Character.Level = RandomStream.FRandRange(1.f, float(BakedDefaults.FindChecked(Character.GroupName).NumLevels));
+	}
+
+	// Same lookups InitAttributeSetDefaultsGradient did before the tables were baked
+	const auto GatherFromMaps = [this](const FBenchmarkCharacter& Character, TArray<TPair<FProperty*, float>>& OutValues)
+	{
+		OutValues.Reset();
+
+		const FPOTAttributeSetDefaultsCollection* Collection = Defaults.Find(Character.GroupName);
+		const FPOTAttributeSetDefaultsCollection* ModCollection = ModDefaults.Find(Character.GroupName);
+		if (!Collection)
+		{
+			Collection = ModCollection;
+		}
+
+		const int32 BottomLevel = FMath::FloorToInt(Character.Level);
+		const int32 TopLevel = FMath::CeilToInt(Character.Level);
+		if (!Collection || !Collection->LevelData.IsValidIndex(BottomLevel - 1) || !Collection->LevelData.IsValidIndex(TopLevel - 1))
+		{
+			return;
+		}
+
+		const FPOTAttributeSetDefaults& BottomSetDefaults = Collection->LevelData[BottomLevel - 1];
+		const FPOTAttributeSetDefaults& TopSetDefaults = Collection->LevelData[TopLevel - 1];
+
+		for (const TPair<TSubclassOf<UAttributeSet>, FPOTAttributeDefaultValueList>& SetPair : BottomSetDefaults.DataMap)
+		{
+			const FPOTAttributeDefaultValueList* DefaultDataList = BottomSetDefaults.DataMap.Find(SetPair.Key);
+			const FPOTAttributeDefaultValueList* TopDefaultDataList = TopSetDefaults.DataMap.Find(SetPair.Key);
 
-			for (int32 i = 0; i < DefaultDataList->List.Num(); i++)
+			const FPOTAttributeDefaultValueList* ModDefaultDataList = nullptr;
+			const FPOTAttributeDefaultValueList* ModTopDefaultDataList = nullptr;
+			if (ModCollection != nullptr && ModCollection->LevelData.IsValidIndex(BottomLevel - 1) && ModCollection->LevelData.IsValidIndex(TopLevel - 1))
 			{
+				ModDefaultDataList = ModCollection->LevelData[BottomLevel - 1].DataMap.Find(SetPair.Key);
+				ModTopDefaultDataList = ModCollection->LevelData[TopLevel - 1].DataMap.Find(SetPair.Key);
+			}
 
+			if (!DefaultDataList || !TopDefaultDataList)
+			{
+				continue;
+			}
+
+			for (int32 i = 0; i < DefaultDataList->List.Num() && i < TopDefaultDataList->List.Num(); i++)
+			{
 				auto DataPairBottom = DefaultDataList->List[i];
 				auto DataPairTop = TopDefaultDataList->List[i];
 
-				if (ModDefaultDataList != nullptr && ModTopDefaultDataList != nullptr 
+				if (ModDefaultDataList != nullptr && ModTopDefaultDataList != nullptr
 					&& ModDefaultDataList->List.IsValidIndex(i) && ModTopDefaultDataList->List.IsValidIndex(i))
 				{
 					DataPairBottom = ModDefaultDataList->List[i];
 					DataPairTop = ModTopDefaultDataList->List[i];
 				}
 
-				
-				check(DataPairBottom.Property && DataPairTop.Property);
+				OutValues.Emplace(DataPairBottom.Property, FMath::Lerp(DataPairBottom.Value, DataPairTop.Value, FMath::Frac(Character.Level)));
+			}
+		}
+	};
 
-				if (Set->ShouldInitProperty(bInitialInit, DataPairBottom.Property))
-				{
-					FGameplayAttribute AttributeToModify(DataPairBottom.Property);
-					float ActualValue = FMath::Lerp(DataPairBottom.Value, DataPairTop.Value, FMath::Frac(Level));
+	const auto GatherFromBaked = [this](const FBenchmarkCharacter& Character, TArray<float>& OutValues)
+	{
+		const FPOTBakedAttributeDefaults& Baked = BakedDefaults.FindChecked(Character.GroupName);
+		const int32 NumAttributes = Baked.Properties.Num();
+		const float* BottomRow = Baked.GetLevelRow(FMath::FloorToInt(Character.Level));
+		const float* TopRow = Baked.GetLevelRow(FMath::CeilToInt(Character.Level));
+		const float Alpha = FMath::Frac(Character.Level);
+
+		OutValues.SetNumUninitialized(NumAttributes);
+		float* OutData = OutValues.GetData();
+		for (int32 Ordinal = 0; Ordinal < NumAttributes; Ordinal++)
+		{
+			OutData[Ordinal] = FMath::Lerp(BottomRow[Ordinal], TopRow[Ordinal], Alpha);
+		}
+	};
 
-					AbilitySystemComponent->SetNumericAttributeBase(AttributeToModify, ActualValue);
-				}
+	TArray<TPair<FProperty*, float>> MapValues;
+	TArray<float> BakedValues;
+
+	// Both tables have to hand out the same value for every attribute
+	int32 NumMismatches = 0;
+	int64 NumValues = 0;
+	for (const FBenchmarkCharacter& Character : Characters)
+	{
+		GatherFromMaps(Character, MapValues);
+		GatherFromBaked(Character, BakedValues);
+
+		const FPOTBakedAttributeDefaults& Baked = BakedDefaults.FindChecked(Character.GroupName);
+		for (const TPair<FProperty*, float>& Pair : MapValues)
+		{
+			const int32 Ordinal = Baked.Properties.IndexOfByKey(Pair.Key);
+			if (Ordinal == INDEX_NONE || !FMath::IsNearlyEqual(BakedValues[Ordinal], Pair.Value))
+			{
+				NumMismatches++;
 			}
 		}
+		NumValues += MapValues.Num();
 	}
 
-	AbilitySystemComponent->ForceReplication();
+	constexpr int32 NumRounds = 100;
+
+	const double MapStart = FPlatformTime::Seconds();
+	for (int32 Round = 0; Round < NumRounds; Round++)
+	{
+		for (const FBenchmarkCharacter& Character : Characters)
+		{
+			GatherFromMaps(Character, MapValues);
+		}
+	}
+	const double MapSeconds = FPlatformTime::Seconds() - MapStart;
+
+	const double BakedStart = FPlatformTime::Seconds();
+	for (int32 Round = 0; Round < NumRounds; Round++)
+	{
+		for (const FBenchmarkCharacter& Character : Characters)
+		{
+			GatherFromBaked(Character, BakedValues);
+		}
+	}
+	const double BakedSeconds = FPlatformTime::Seconds() - BakedStart;
+
+	const FString Summary = FString::Printf(TEXT("GradientDefaults: %d characters x %d rounds, %d groups, %lld values. Maps: %.3fms Baked: %.3fms Mismatches: %d"),
+		NumCharacters, NumRounds, GroupNames.Num(), NumValues, MapSeconds * 1000.0, BakedSeconds * 1000.0, NumMismatches);
+
+	ABILITY_LOG(Log, TEXT("FPOTAttributeSetInitter::BenchmarkGradientDefaults: %s"), *Summary);
+
+	return Summary;
 }
 
 void FPOTAttributeSetInitter::ApplyAttributeDefaultGradient(UAbilitySystemComponent* AbilitySystemComponent, FGameplayAttribute& InAttribute, FName GroupName, float Level) const
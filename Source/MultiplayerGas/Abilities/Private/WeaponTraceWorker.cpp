@@ -3,6 +3,9 @@
 #include "Abilities/WeaponTraceWorker.h"
 //#include "EngineMinimal.h"
 #include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
 #include "Stats/IStats.h"
 #include "Player/IBaseCharacter.h"
 
@@ -12,10 +15,87 @@ static_assert(HIT_BUFFER_SIZE > 0, "Invalid hit buffer size.");
 //#include "Engine/World.h"
 //#include "PhysicsFiltering.h"
 
+DECLARE_STATS_GROUP(TEXT("WeaponTraces"), STATGROUP_WeaponTraces, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Queued Trace Sets"), STAT_WeaponTraceQueueDepth, STATGROUP_WeaponTraces);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sweeps Per Second"), STAT_WeaponTraceSweepsPerSecond, STATGROUP_WeaponTraces);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Enqueue To Propagation (ms)"), STAT_WeaponTraceLatencyMs, STATGROUP_WeaponTraces);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Trace Sets Propagated"), STAT_WeaponTracePropagatedSets, STATGROUP_WeaponTraces);
+
+static TAutoConsoleVariable<int32> CVarWeaponTraceWorkerThreads(
+	TEXT("pot.WeaponTraceWorkerThreads"),
+	0,
+	TEXT("Number of weapon trace worker threads. Read once when the pool is created.\n")
+	TEXT(" 0: one thread per four logical cores (clamped to 1-4), otherwise the explicit thread count"),
+	ECVF_ReadOnly);
 
 FWeaponTraceWorker* FWeaponTraceWorker::Instance = nullptr;
 
+FWeaponTraceLane::FWeaponTraceLane(FWeaponTraceWorker* InOwner, int32 InLaneIndex)
+	: Owner(InOwner)
+{
+	WorkEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	Thread = FRunnableThread::Create(this, *FString::Printf(TEXT("FWeaponTraceWorker_%d"), InLaneIndex), 0U, TPri_Highest);
+}
+
+FWeaponTraceLane::~FWeaponTraceLane()
+{
+	ShutDown();
+}
 
+bool FWeaponTraceLane::Init()
+{
+	return true;
+}
+
+uint32 FWeaponTraceLane::Run()
+{
+	while (StopTaskCounter.GetValue() == 0)
+	{
+		FPendingTraceSet PendingSet;
+		while (StopTaskCounter.GetValue() == 0 && WorkQueue.Dequeue(PendingSet))
+		{
+			Owner->ProcessTraceSet(PendingSet);
+		}
+
+		// Enqueue triggers the event, the timeout only guards against a missed wake up.
+		WorkEvent->Wait(FTimespan::FromSeconds(ONE_FRAMES_AT_60FPS));
+	}
+
+	return 0;
+}
+
+void FWeaponTraceLane::Stop()
+{
+	StopTaskCounter.Increment();
+
+	if (WorkEvent)
+	{
+		WorkEvent->Trigger();
+	}
+}
+
+void FWeaponTraceLane::ShutDown()
+{
+	if (Thread)
+	{
+		Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	if (WorkEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+		WorkEvent = nullptr;
+	}
+}
+
+void FWeaponTraceLane::Enqueue(FPendingTraceSet&& PendingSet)
+{
+	WorkQueue.Enqueue(MoveTemp(PendingSet));
+	WorkEvent->Trigger();
+}
 
 FWeaponTraceWorker* FWeaponTraceWorker::Get()
 {
@@ -28,7 +108,21 @@ FWeaponTraceWorker* FWeaponTraceWorker::Get()
 
 FWeaponTraceWorker::FWeaponTraceWorker()
 {
-	Thread = FRunnableThread::Create(this, TEXT("FWeaponTraceWorker"), 0U, TPri_Highest);
+	int32 NumLanes = CVarWeaponTraceWorkerThreads.GetValueOnAnyThread();
+	if (NumLanes <= 0)
+	{
+		NumLanes = FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads() / 4, 1, 4);
+	}
+
+	SweepWindowStartCycles.store(FPlatformTime::Cycles64());
+
+	Lanes.Reserve(NumLanes);
+	for (int32 LaneIndex = 0; LaneIndex < NumLanes; LaneIndex++)
+	{
+		Lanes.Add(MakeUnique<FWeaponTraceLane>(this, LaneIndex));
+	}
+
+	BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddRaw(this, &FWeaponTraceWorker::DrainCompletedTraceSets);
 }
 
 FWeaponTraceWorker::~FWeaponTraceWorker()
@@ -36,59 +130,62 @@ FWeaponTraceWorker::~FWeaponTraceWorker()
 	ShutDown();
 }
 
-bool FWeaponTraceWorker::Init()
-{
-	return true;
-}
-
-uint32 FWeaponTraceWorker::Run()
+void FWeaponTraceWorker::ShutDown()
 {
-	while (StopTaskCounter.GetValue() == 0)
+	if (BeginFrameHandle.IsValid())
 	{
-		
-		FQueuedTraceSet CurrentTraceSet;
-		if (WorkQueue.Dequeue(CurrentTraceSet))
-		{
-			ProcessTraceSet(CurrentTraceSet);
-		}
+		FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+		BeginFrameHandle.Reset();
+	}
 
-		FPlatformProcess::ConditionalSleep([&]()
-		{
-			bool bQueueEmpty = WorkQueue.IsEmpty();
-			bool bIsStopping = StopTaskCounter.GetValue() > 0;
-			return !bQueueEmpty || bIsStopping;
-		}, ONE_FRAMES_AT_120FPS);
+	for (TUniquePtr<FWeaponTraceLane>& Lane : Lanes)
+	{
+		Lane->ShutDown();
 	}
 
-	return 0;
+	CompletedQueue.Empty();
 }
 
-void FWeaponTraceWorker::Stop()
+int32 FWeaponTraceWorker::GetLaneIndex(const FQueuedTraceSet& QueueSet) const
 {
-	StopTaskCounter.Increment();
+	// Pinning a character to one lane keeps its sets in order without any cross-lane locking.
+	return static_cast<int32>(GetTypeHash(QueueSet.CharacterPtr) % static_cast<uint32>(Lanes.Num()));
 }
 
-void FWeaponTraceWorker::ShutDown()
+void FWeaponTraceWorker::QueueTraces(const FQueuedTraceSet& QueueSet)
 {
-	Stop();
-	Thread->WaitForCompletion();
+	QueueTraces(FQueuedTraceSet(QueueSet));
 }
 
-void FWeaponTraceWorker::QueueTraces(const FQueuedTraceSet& QueueSet)
+void FWeaponTraceWorker::QueueTraces(FQueuedTraceSet&& QueueSet)
 {
 	if (!QueueSet.CharacterPtr.IsValid())
 	{
 		return;
 	}
 
-	WorkQueue.Enqueue(QueueSet);
+	const int32 LaneIndex = GetLaneIndex(QueueSet);
+
+	FPendingTraceSet PendingSet;
+	PendingSet.TraceSet = MoveTemp(QueueSet);
+	PendingSet.EnqueueCycles = FPlatformTime::Cycles64();
+
+	QueueDepth.Increment();
+	INC_DWORD_STAT(STAT_WeaponTraceQueueDepth);
+
+	Lanes[LaneIndex]->Enqueue(MoveTemp(PendingSet));
 
 	//ProcessTraceSet(QueueSet);
 
 }
 
-void FWeaponTraceWorker::ProcessTraceSet(FQueuedTraceSet CurrentTraceSet)
+void FWeaponTraceWorker::ProcessTraceSet(FPendingTraceSet& PendingSet)
 {
+	QueueDepth.Decrement();
+	DEC_DWORD_STAT(STAT_WeaponTraceQueueDepth);
+
+	FQueuedTraceSet& CurrentTraceSet = PendingSet.TraceSet;
+
 	if (!CurrentTraceSet.CharacterPtr.IsValid())
 	{
 		return;
@@ -102,7 +199,8 @@ void FWeaponTraceWorker::ProcessTraceSet(FQueuedTraceSet CurrentTraceSet)
 	}
 
 	bool bHit = false;
-	
+	int32 NumSweeps = 0;
+
 	for (FQueuedTraceItem& TraceItem : CurrentTraceSet.Items)
 	{
 		if (IsValid(World))
@@ -115,6 +213,8 @@ void FWeaponTraceWorker::ProcessTraceSet(FQueuedTraceSet CurrentTraceSet)
 				TraceItem.Shape,
 				TraceItem.QueryParams);
 
+			NumSweeps++;
+
 			//In this case bHit will only be true if there is a BLOCKING hit (and we want overlap too)
 			bHit |= TraceItem.OutResults.Num() > 0;
 
@@ -124,19 +224,56 @@ void FWeaponTraceWorker::ProcessTraceSet(FQueuedTraceSet CurrentTraceSet)
 		}
 	}
 
+	RecordSweeps(NumSweeps);
+
 	if (bHit)
 	{
+		// Hit arrays are moved into the buffer, the game thread picks them up in DrainCompletedTraceSets.
+		CompletedQueue.Enqueue(MoveTemp(PendingSet));
+	}
+}
+
+void FWeaponTraceWorker::RecordSweeps(int32 NumSweeps)
+{
+	SweepsInWindow.Add(NumSweeps);
+
+	uint64 WindowStart = SweepWindowStartCycles.load();
+	const uint64 Now = FPlatformTime::Cycles64();
+	const double WindowSeconds = FPlatformTime::ToSeconds64(Now - WindowStart);
+
+	// Only the lane that wins the exchange publishes the window, the others keep counting into the next one.
+	if (WindowSeconds >= 1.0 && SweepWindowStartCycles.compare_exchange_strong(WindowStart, Now))
+	{
+		const int32 WindowSweeps = SweepsInWindow.Set(0);
+		SET_DWORD_STAT(STAT_WeaponTraceSweepsPerSecond, FMath::RoundToInt(WindowSweeps / WindowSeconds));
+	}
+}
+
+void FWeaponTraceWorker::DrainCompletedTraceSets()
+{
+	check(IsInGameThread());
+
+	if (CompletedQueue.IsEmpty())
+	{
+		return;
+	}
 
-		FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
+	SCOPE_CYCLE_COUNTER(STAT_PerformDamageSweeps);
 
-			FSimpleDelegateGraphTask::FDelegate::CreateRaw(this, &FWeaponTraceWorker::PropagateTraceResults, CurrentTraceSet),
-			GET_STATID(STAT_PerformDamageSweeps), NULL, ENamedThreads::GameThread
-		);
+	FPendingTraceSet PendingSet;
+	while (CompletedQueue.Dequeue(PendingSet))
+	{
+		PropagateTraceResults(PendingSet);
 	}
 }
 
-void FWeaponTraceWorker::PropagateTraceResults(FQueuedTraceSet TraceSet)
+void FWeaponTraceWorker::PropagateTraceResults(FPendingTraceSet& PendingSet)
 {
+	SET_FLOAT_STAT(STAT_WeaponTraceLatencyMs, FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - PendingSet.EnqueueCycles));
+	INC_DWORD_STAT(STAT_WeaponTracePropagatedSets);
+
+	FQueuedTraceSet& TraceSet = PendingSet.TraceSet;
+
 	if (!TraceSet.CharacterPtr.IsValid())
 	{
 		return;
@@ -144,4 +281,3 @@ void FWeaponTraceWorker::PropagateTraceResults(FQueuedTraceSet TraceSet)
 
 	TraceSet.CharacterPtr->ProcessCompletedTraceSet(TraceSet);
 }
-
@@ -91,15 +91,3 @@
 		bHasDirtyConditionalProperty = true; \
 		bCondRepActive_##PropertyName = bActive; \
 	}
-
-#define DOREPLIFETIME_ACTIVE_OVERRIDE_POT_CONDITIONAL(Object, ClassName, PropName) \
-	{ \
-		if (!bHasDoneInitialReplication) \
-		{ \
-			DOREPLIFETIME_ACTIVE_OVERRIDE_UOBJECT_FAST(Object, ClassName, PropName, true); \
-		} \
-		else \
-		{ \
-			DOREPLIFETIME_ACTIVE_OVERRIDE_UOBJECT_FAST(Object, ClassName, PropName, bCondRepActive_##PropName); \
-		} \
-	}
\ No newline at end of file
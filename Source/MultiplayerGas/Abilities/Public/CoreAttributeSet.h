@@ -650,6 +650,18 @@ public:
 
 	virtual void UpdateTagBasedOnAttribute(const FGameplayAttribute& Attribute, const float NewValue, const FName& TagName);
 
+	/** Resolves the debuff tags of AdjustForCurrentAttributes and DebuffTagsToRemove once, called from UPOTAbilitySystemGlobals::InitGlobalData */
+	static void InitDebuffTags();
+
+	/** Cached tag for a debuff name. Names missing from the table are requested by name and cached once they resolve */
+	static FGameplayTag FindDebuffTag(const FName& TagName);
+
+	/** Adds or removes Tag from GameplayTags for the new attribute value, the tag logic of UpdateTagBasedOnAttribute */
+	static void ApplyDebuffTag(FGameplayTagContainer& GameplayTags, const FGameplayTag& Tag, const FGameplayAttribute& Attribute, const float NewValue, const float CurrentHealth);
+
+	/** Checks the cached debuff tags against tags requested by name, then times debuff attribute changes for a full server both ways */
+	static FString BenchmarkDebuffTags(int32 NumSeconds);
+
 	virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
 	static void GetNewAttributeVsCapValue(const FPOTAdjustCurrentAttribute& CurrentAdjust, const FGameplayAttribute& Attribute, float& NewValue);
 	virtual void PreAttributeBaseChange(const FGameplayAttribute& Attribute, float& NewValue) const override;
@@ -668,11 +680,34 @@ public:
 	bool bHasDoneInitialReplication = false;
 
 protected:
+	// A conditionally replicated attribute, its CondRep_ flag and its replication index
+	struct FConditionalRepAttribute
+	{
+		FName AttributeName;
+		int32 RepIndex = INDEX_NONE;
+		bool UCoreAttributeSet::* bActive = nullptr;
+	};
+
+	struct FConditionalRepTable
+	{
+		TArray<FConditionalRepAttribute> Attributes;
+		TMap<FName, int32> OrdinalByName;
+	};
+
+	// Built once for the class, ordinals index AppliedConditionalRep
+	static const FConditionalRepTable& GetConditionalRepTable();
+
+	// Active override last handed to the changed property tracker per conditional attribute ordinal
+	TBitArray<> AppliedConditionalRep;
+
 	UPROPERTY(ReplicatedUsing = OnRep_AttributeCapsConfig)
 	TArray<FAttributeCapData> AttributeCapsConfig;
 	
 	inline static TMap<FName, float> AttributeCaps{};
 
+	// Debuff name -> tag, so attribute changes don't go through the tag manager's name lookup
+	inline static TMap<FName, FGameplayTag> DebuffTags{};
+
 	UFUNCTION()
 	virtual void OnRep_AttributeCapsConfig();
 
@@ -494,6 +494,10 @@ public:
 
 	void RemoveBoneDamageMultipliersOnEffectRemoved(const FActiveGameplayEffect& RemovedEffect);
 
+	// Keep ReEvalEffectHandles in sync with the active effects carrying a ReEval.Attribute tag
+	void IndexReEvalEffect(const FActiveGameplayEffect& Effect);
+	void UnindexReEvalEffect(const FActiveGameplayEffect& RemovedEffect);
+
 	virtual void RemoveAllBuffs();
 
 	virtual void NotifyAbilityEnded(FGameplayAbilitySpecHandle Handle, UGameplayAbility* Ability, 
@@ -704,6 +708,11 @@ private:
 	// When parsing EventTags in HandleGameplayEvent if EventTag is found inside this container
 	// it will not fire event
 	FGameplayTagContainer EventsToIgnore;
+
+	// ReEval.Attribute.<Attribute> tag -> active effects whose level follows that attribute.
+	// Only maintained on authority, clients fall back to scanning their active effects
+	TMap<FGameplayTag, TArray<FActiveGameplayEffectHandle>> ReEvalEffectHandles;
+	bool bReEvalEffectsIndexed = false;
 private:
 
 	FTimerHandle LocomotionUpdateTimerHandle;
@@ -27,7 +27,9 @@ public:
 	virtual void InitAttributeSetDefaultsGradient(UAbilitySystemComponent* AbilitySystemComponent, FName GroupName, float Level, bool bInitialInit) const;
 	virtual void ApplyAttributeDefaultGradient(UAbilitySystemComponent* AbilitySystemComponent, FGameplayAttribute& InAttribute, FName GroupName, float Level) const;
 
-	
+	// Computes gradient defaults for NumCharacters random groups and levels from the preloaded maps and from the baked tables, and checks they agree
+	FString BenchmarkGradientDefaults(int32 NumCharacters) const;
+
 
 protected:
 	TSubclassOf<UAttributeSet> FindBestAttributeClass(TArray<TSubclassOf<UAttributeSet> >& ClassList, FString PartialName);
@@ -75,9 +77,54 @@ protected:
 	TMap<FName, FPOTAttributeSetDefaultsCollection>	Defaults;
 	TMap<FName, FPOTAttributeSetDefaultsCollection> ModDefaults;
 
+	/**
+	 * Defaults and mod overrides of one group flattened into a level major table, so a gradient init
+	 * lerps two contiguous rows instead of looking up every set per level.
+	 * Values missing from the curve tables for a level are NaN and never applied.
+	 */
+	struct FPOTBakedAttributeDefaults
+	{
+		// The attributes of one attribute set class occupy a contiguous range of ordinals
+		struct FSetRange
+		{
+			TSubclassOf<UAttributeSet> SetClass;
+			int32 FirstOrdinal = 0;
+			int32 NumAttributes = 0;
+		};
+
+		const FSetRange* FindSet(const UClass* SetClass) const
+		{
+			return Sets.FindByPredicate([SetClass](const FSetRange& Range) { return Range.SetClass == SetClass; });
+		}
+
+		// Row of attribute values for a 1 based level
+		const float* GetLevelRow(int32 Level) const
+		{
+			return Values.GetData() + (Level - 1) * Properties.Num();
+		}
+
+		TArray<FSetRange> Sets;
+
+		// Attribute ordinal -> property
+		TArray<FProperty*> Properties;
+
+		// Values[(Level - 1) * Properties.Num() + Ordinal]
+		TArray<float> Values;
+
+		int32 NumLevels = 0;
+	};
+
+	TMap<FName, FPOTBakedAttributeDefaults> BakedDefaults;
+
 protected:
 	void SanitizeGroupName(FName& InName) const;
 
+	// Rebuilds BakedDefaults, called whenever Defaults or ModDefaults change
+	void BakeDefaults();
+
+	// Baked table for a group, falling back to the Default group like the unbaked lookups do
+	const FPOTBakedAttributeDefaults* FindBakedDefaults(FName GroupName) const;
+
 	void PreloadCurveData(const TArray<UCurveTable*>& CurveData, TMap<FName, FPOTAttributeSetDefaultsCollection>& InDefaults);
 	void PreloadCurveDataFromCSV(const FString& CSV, TMap<FName, FPOTAttributeSetDefaultsCollection>& InDefaults);
 
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "HAL/Runnable.h"
+#include <atomic>
 #include "GameplayTagContainer.h"
 #include "PathOfTitans/PathOfTitans.h"
 #include "ITypes.h"
@@ -13,25 +14,33 @@
 #define ONE_FRAMES_AT_120FPS  0.008f
 
 class IBaseCharacter;
+class FEvent;
 
 /**
- * 
+ * A trace set waiting in a lane, stamped with the time it was queued so the
+ * enqueue -> propagation latency can be reported.
  */
-class PATHOFTITANS_API FWeaponTraceWorker : public FRunnable
+struct FPendingTraceSet
+{
+	FQueuedTraceSet TraceSet;
+	uint64 EnqueueCycles = 0;
+};
+
+/**
+ * One worker thread of the weapon trace pool. Any thread may enqueue into a lane,
+ * only the lane's own thread dequeues from it.
+ */
+class PATHOFTITANS_API FWeaponTraceLane : public FRunnable
 {
 public:
+	TQueue<FPendingTraceSet, EQueueMode::Mpsc> WorkQueue;
 
-	TQueue<FQueuedTraceSet, EQueueMode::Spsc> WorkQueue;
-	
-	//Thread safe counter 
+	//Thread safe counter
 	FThreadSafeCounter StopTaskCounter;
 
 public:
-	static FWeaponTraceWorker* Get();
-
-
-	FWeaponTraceWorker();
-	virtual ~FWeaponTraceWorker();
+	FWeaponTraceLane(class FWeaponTraceWorker* InOwner, int32 InLaneIndex);
+	virtual ~FWeaponTraceLane();
 
 	//FRunnable interface
 	virtual bool Init() override;
@@ -40,18 +49,68 @@ public:
 
 	void ShutDown();
 
-	void QueueTraces(const FQueuedTraceSet& QueueSet);
+	void Enqueue(FPendingTraceSet&& PendingSet);
 
 private:
+	class FWeaponTraceWorker* Owner = nullptr;
+
 	//Thread to run the FRunnable on
-	FRunnableThread* Thread;
+	FRunnableThread* Thread = nullptr;
+
+	// Triggered when work is queued or the lane is stopping
+	FEvent* WorkEvent = nullptr;
+};
+
+/**
+ * Pool of weapon trace lanes. Trace sets are distributed across lanes by character so a single
+ * character's sets are always swept, and propagated, in the order they were queued.
+ * Sets that hit are handed back through a lock-free buffer drained once per frame on the game thread.
+ */
+class PATHOFTITANS_API FWeaponTraceWorker
+{
+	friend class FWeaponTraceLane;
+
+public:
+	static FWeaponTraceWorker* Get();
+
+	FWeaponTraceWorker();
+	virtual ~FWeaponTraceWorker();
+
+	void ShutDown();
+
+	void QueueTraces(const FQueuedTraceSet& QueueSet);
+	void QueueTraces(FQueuedTraceSet&& QueueSet);
+
+	// Delivers every completed trace set to its character, called once per frame on the game thread.
+	void DrainCompletedTraceSets();
+
+	int32 GetNumLanes() const { return Lanes.Num(); }
+	int32 GetQueueDepth() const { return QueueDepth.GetValue(); }
+
+private:
+	TArray<TUniquePtr<FWeaponTraceLane>> Lanes;
+
+	// Trace sets queued but not yet swept, across all lanes
+	FThreadSafeCounter QueueDepth;
+
+	// Swept sets with hits, filled by the lanes and drained on the game thread
+	TQueue<FPendingTraceSet, EQueueMode::Mpsc> CompletedQueue;
+
+	FDelegateHandle BeginFrameHandle;
+
+	// Sweeps performed in the current one second window
+	FThreadSafeCounter SweepsInWindow;
+	std::atomic<uint64> SweepWindowStartCycles{ 0 };
 
 	// Singleton instance
 	static FWeaponTraceWorker* Instance;
 
 private:
-	void ProcessTraceSet(FQueuedTraceSet CurrentTraceSet);
-	
-	UFUNCTION()
-	void PropagateTraceResults(FQueuedTraceSet TraceSet);
+	int32 GetLaneIndex(const FQueuedTraceSet& QueueSet) const;
+
+	void ProcessTraceSet(FPendingTraceSet& PendingSet);
+
+	void RecordSweeps(int32 NumSweeps);
+
+	void PropagateTraceResults(FPendingTraceSet& PendingSet);
 };
@@ -27,6 +27,7 @@
 #include "Abilities/CoreAttributeSet.h"
 #include "AbilitySystemComponent.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Async/ParallelFor.h"
 #include "Stats/Stats.h"
 #include "Stats/IStats.h"
 #include "Perception/AISense_Hearing.h"
@@ -159,6 +160,41 @@ static const float DelayCollisionAfterUnlatchTime = 0.5f;
 
 static const FQuat RelativeClampedSpringArmRotation = FQuat::MakeFromRotator(FRotator(-45, 90, 0));
 
+DECLARE_STATS_GROUP(TEXT("FocusSweeps"), STATGROUP_FocusSweeps, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Focus Sweeps Run"), STAT_FocusSweepsRun, STATGROUP_FocusSweeps);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Focus Sweeps Skipped"), STAT_FocusSweepsSkipped, STATGROUP_FocusSweeps);
+
+static TAutoConsoleVariable<int32> CVarFocusSweepThrottle(
+	TEXT("pot.FocusSweepThrottle"),
+	1,
+	TEXT("Skip the focus target sweep while the view hasn't moved.\n")
+	TEXT(" 0: sweep every frame, otherwise throttled"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFocusSweepMoveThreshold(
+	TEXT("pot.FocusSweepMoveThreshold"),
+	5.0f,
+	TEXT("Distance in uu the focus trace start has to move before the focus sweep runs again."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFocusSweepAngleThreshold(
+	TEXT("pot.FocusSweepAngleThreshold"),
+	0.5f,
+	TEXT("Degrees the view has to turn before the focus sweep runs again."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFocusSweepInterval(
+	TEXT("pot.FocusSweepInterval"),
+	0.1f,
+	TEXT("Seconds between focus sweeps from a still view while the last sweep hit another pawn."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFocusSweepIdleInterval(
+	TEXT("pot.FocusSweepIdleInterval"),
+	0.4f,
+	TEXT("Seconds between focus sweeps from a still view while no pawns are around."),
+	ECVF_Default);
+
 AIBaseCharacter::AIBaseCharacter(const class FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer.SetDefaultSubobjectClass<UICharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
@@ -354,8 +390,260 @@ static void WriteRawToTexture_RenderThread(FTexture2DDynamicResource* TextureRes
 	delete RawData;
 }
 
+// Keeps blood mask textures of characters that went away per resolution, so characters coming into relevancy don't allocate new ones
+class FBloodMaskTexturePool : public FGCObject
+{
+public:
+	static FBloodMaskTexturePool& Get()
+	{
+		static FBloodMaskTexturePool Pool;
+		return Pool;
+	}
+
+	UTexture2DDynamic* Acquire(const FIntPoint& Size)
+	{
+		if (TArray<TObjectPtr<UTexture2DDynamic>>* Textures = FreeTextures.Find(Size))
+		{
+			while (!Textures->IsEmpty())
+			{
+				UTexture2DDynamic* const Texture = Textures->Pop(false);
+				if (IsValid(Texture))
+				{
+					return Texture;
+				}
+			}
+		}
+
+		FTexture2DDynamicCreateInfo CreateInfo{};
+		CreateInfo.bSRGB = false;
+		CreateInfo.Format = PF_B8G8R8A8;
+
+		UTexture2DDynamic* const NewTexture = UTexture2DDynamic::Create(Size.X, Size.Y, CreateInfo);
+		if (NewTexture)
+		{
+			NewTexture->CompressionSettings = TC_VectorDisplacementmap;
+			NewTexture->UpdateResource();
+		}
+
+		return NewTexture;
+	}
+
+	void Release(UTexture2DDynamic* Texture)
+	{
+		if (!IsValid(Texture))
+		{
+			return;
+		}
+
+		TArray<TObjectPtr<UTexture2DDynamic>>& Textures = FreeTextures.FindOrAdd(FIntPoint(Texture->SizeX, Texture->SizeY));
+		if (Textures.Num() < MaxPooledPerSize)
+		{
+			Textures.Add(Texture);
+		}
+		else
+		{
+			Texture->ConditionalBeginDestroy();
+		}
+	}
+
+	//FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+	{
+		for (TPair<FIntPoint, TArray<TObjectPtr<UTexture2DDynamic>>>& Pair : FreeTextures)
+		{
+			Collector.AddReferencedObjects(Pair.Value);
+		}
+	}
+
+	virtual FString GetReferencerName() const override
+	{
+		return TEXT("FBloodMaskTexturePool");
+	}
+
+private:
+	static constexpr int32 MaxPooledPerSize = 16;
+
+	TMap<FIntPoint, TArray<TObjectPtr<UTexture2DDynamic>>> FreeTextures;
+};
+
 #endif
 
+void AIBaseCharacter::BuildBloodMaskRegions(const FBloodMaskPixelData& PixelData, const TArray<FCachedWoundDamage>& WoundValues, TArray<uint8>& OutRegions)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIBaseCharacter::BuildBloodMaskRegions"))
+
+	check(WoundValues.Num() < MAX_uint8);
+
+	// Alpha is ignored, the first wound with a matching colour wins
+	TMap<uint32, uint8> RegionByColor;
+	for (int32 WoundIndex = 0; WoundIndex < WoundValues.Num(); WoundIndex++)
+	{
+		const FColor& Color = WoundValues[WoundIndex].Color;
+		const uint32 ColorKey = Color.B | (Color.G << 8) | (Color.R << 16);
+		if (!RegionByColor.Contains(ColorKey))
+		{
+			RegionByColor.Add(ColorKey, (uint8)(WoundIndex + 1));
+		}
+	}
+
+	const int32 NumPixels = PixelData.Pixels.Num() / 4;
+	OutRegions.SetNumUninitialized(NumPixels);
+
+	const uint8* const Source = PixelData.Pixels.GetData();
+	uint32 LastColorKey = MAX_uint32;
+	uint8 LastRegion = 0;
+	for (int32 PixelIndex = 0; PixelIndex < NumPixels; PixelIndex++)
+	{
+		const uint8* const Pixel = Source + PixelIndex * 4;
+		const uint32 ColorKey = Pixel[0] | (Pixel[1] << 8) | (Pixel[2] << 16);
+
+		// Regions are large flat patches, most pixels match their neighbour
+		if (ColorKey != LastColorKey)
+		{
+			const uint8* const Region = RegionByColor.Find(ColorKey);
+			LastRegion = Region ? *Region : 0;
+			LastColorKey = ColorKey;
+		}
+
+		OutRegions[PixelIndex] = LastRegion;
+	}
+}
+
+void AIBaseCharacter::FillBloodMaskPixels(const TArray<uint8>& Regions, const TArray<FCachedWoundDamage>& WoundValues, TArray64<uint8>& OutPixels)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIBaseCharacter::FillBloodMaskPixels"))
+
+	// Region -> output pixel, region 0 has no wound
+	FColor RegionColors[MAX_uint8 + 1];
+	RegionColors[0] = FColor(0, 0, 0, 255);
+	for (int32 WoundIndex = 0; WoundIndex < WoundValues.Num() && WoundIndex < MAX_uint8; WoundIndex++)
+	{
+		const uint8 Opacity = WoundValues[WoundIndex].CachedOpacity;
+		RegionColors[WoundIndex + 1] = FColor(Opacity, Opacity, Opacity, 255);
+	}
+
+	const int32 NumPixels = Regions.Num();
+	OutPixels.SetNumUninitialized((int64)NumPixels * 4);
+
+	// FColor is laid out BGRA in memory, the same as the texture
+	FColor* const Dest = reinterpret_cast<FColor*>(OutPixels.GetData());
+	const uint8* const RegionData = Regions.GetData();
+
+	constexpr int32 PixelsPerTask = 16384;
+	const int32 NumTasks = FMath::DivideAndRoundUp(NumPixels, PixelsPerTask);
+	ParallelFor(NumTasks, [&RegionColors, Dest, RegionData, NumPixels](int32 TaskIndex)
+	{
+		const int32 Start = TaskIndex * PixelsPerTask;
+		const int32 End = FMath::Min(Start + PixelsPerTask, NumPixels);
+		for (int32 PixelIndex = Start; PixelIndex < End; PixelIndex++)
+		{
+			Dest[PixelIndex] = RegionColors[RegionData[PixelIndex]];
+		}
+	});
+}
+
+FString AIBaseCharacter::BenchmarkBloodMask(int32 Iterations)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIBaseCharacter::BenchmarkBloodMask"))
+
+	Iterations = FMath::Max(Iterations, 1);
+
+	constexpr int32 TextureSize = 1024;
+
+	TArray<FCachedWoundDamage> WoundValues = GetDefault<AIBaseCharacter>()->CachedWoundValues;
+	if (WoundValues.IsEmpty())
+	{
+		return TEXT("BloodMask: no wound colours");
+	}
+
+	// Synthetic mask of flat wound patches in the wound colours plus some unpainted area
+	FRandomStream RandomStream(TextureSize);
+	FBloodMaskPixelData PixelData;
+	PixelData.TextureSize = FVector2D(TextureSize, TextureSize);
+	PixelData.Pixels.SetNumUninitialized(TextureSize * TextureSize * 4);
+	for (int32 PixelIndex = 0; PixelIndex < TextureSize * TextureSize; PixelIndex++)
+	{
+		const int32 Patch = ((PixelIndex / TextureSize) / 64) * (TextureSize / 64) + (PixelIndex % TextureSize) / 64;
+		const int32 WoundIndex = Patch % (WoundValues.Num() + 4);
+		const FColor Color = WoundValues.IsValidIndex(WoundIndex) ? WoundValues[WoundIndex].Color : FColor(40, 40, 40, 255);
+
+		PixelData.Pixels[PixelIndex * 4] = Color.B;
+		PixelData.Pixels[PixelIndex * 4 + 1] = Color.G;
+		PixelData.Pixels[PixelIndex * 4 + 2] = Color.R;
+		PixelData.Pixels[PixelIndex * 4 + 3] = 255;
+	}
+
+	// The per pixel search UpdateBloodMask did before regions were cached
+	const auto FillLegacy = [&PixelData, &WoundValues](TArray64<uint8>& OutPixels)
+	{
+		auto GetWoundOpacity = [&](uint8 B, uint8 G, uint8 R) -> uint8
+		{
+			for (const FCachedWoundDamage& CachedWoundValue : WoundValues)
+			{
+				const FColor& SourceColor = CachedWoundValue.Color;
+				if (SourceColor.B != B || SourceColor.G != G || SourceColor.R != R)
+				{
+					continue;
+				}
+
+				return CachedWoundValue.CachedOpacity;
+			}
+
+			return 0;
+		};
+
+		OutPixels.SetNumUninitialized(PixelData.Pixels.Num());
+		uint8* const PixelArrayStart = OutPixels.GetData();
+		for (int32 CurrentPixelIndex = 0; CurrentPixelIndex < PixelData.Pixels.Num(); CurrentPixelIndex += 4)
+		{
+			const uint8 FinalOpacity = GetWoundOpacity(PixelData.Pixels[CurrentPixelIndex], PixelData.Pixels[CurrentPixelIndex + 1], PixelData.Pixels[CurrentPixelIndex + 2]);
+			PixelArrayStart[CurrentPixelIndex] = FinalOpacity; // B
+			PixelArrayStart[CurrentPixelIndex + 1] = FinalOpacity; // G
+			PixelArrayStart[CurrentPixelIndex + 2] = FinalOpacity; // R
+			PixelArrayStart[CurrentPixelIndex + 3] = 255; // A
+		}
+	};
+
+	TArray<uint8> Regions;
+	const double RegionsStart = FPlatformTime::Seconds();
+	BuildBloodMaskRegions(PixelData, WoundValues, Regions);
+	const double RegionsSeconds = FPlatformTime::Seconds() - RegionsStart;
+
+	TArray64<uint8> LegacyPixels;
+	TArray64<uint8> LookupPixels;
+	double LegacySeconds = 0.0;
+	double LookupSeconds = 0.0;
+	int32 NumMismatchedUpdates = 0;
+
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		for (FCachedWoundDamage& WoundValue : WoundValues)
+		{
+			WoundValue.CachedOpacity = (uint8)RandomStream.RandRange(0, 255);
+		}
+
+		const double LegacyStart = FPlatformTime::Seconds();
+		FillLegacy(LegacyPixels);
+		LegacySeconds += FPlatformTime::Seconds() - LegacyStart;
+
+		const double LookupStart = FPlatformTime::Seconds();
+		FillBloodMaskPixels(Regions, WoundValues, LookupPixels);
+		LookupSeconds += FPlatformTime::Seconds() - LookupStart;
+
+		if (LegacyPixels.Num() != LookupPixels.Num() || FMemory::Memcmp(LegacyPixels.GetData(), LookupPixels.GetData(), LegacyPixels.Num()) != 0)
+		{
+			NumMismatchedUpdates++;
+		}
+	}
+
+	const FString Summary = FString::Printf(TEXT("BloodMask: %dx%d, %d updates. Regions built in %.3fms. Search: %.3fms Lookup: %.3fms Mismatched updates: %d"),
+		TextureSize, TextureSize, Iterations, RegionsSeconds * 1000.0, LegacySeconds * 1000.0, LookupSeconds * 1000.0, NumMismatchedUpdates);
+
+	UE_LOG(TitansLog, Log, TEXT("AIBaseCharacter::BenchmarkBloodMask: %s"), *Summary);
+
+	return Summary;
+}
+
 void AIBaseCharacter::CacheBloodMaskPixels()
 {
 	if (!BloodMaskSource)
@@ -474,69 +762,33 @@ void AIBaseCharacter::UpdateBloodMask(bool bForceUpdate)
 		return;
 	}
 
-	auto GetWoundOpacity = [&](uint8 B, uint8 G, uint8 R) -> uint8
+	if (BloodMaskRegions.Num() * 4 != BloodMaskPixelData.Pixels.Num())
 	{
-		for (const FCachedWoundDamage& CachedWoundValue : CachedWoundValues)
-		{
-			const FColor& SourceColor = CachedWoundValue.Color;
-			if (SourceColor.B != B || SourceColor.G != G || SourceColor.R != R)
-			{
-				continue;
-			}
-
-			return CachedWoundValue.CachedOpacity;		
-		}
-
-		return 0;
-	};	
-
-	FTexture2DDynamicCreateInfo CreateInfo{};
-	CreateInfo.bSRGB = false;
-	CreateInfo.Format = PF_B8G8R8A8;
-
-	UTexture2DDynamic* const NewTexture = UTexture2DDynamic::Create(BloodMaskPixelData.TextureSize.X, BloodMaskPixelData.TextureSize.Y, CreateInfo);
-	if (!NewTexture)
-	{
-		UE_LOG(LogTemp, Error, TEXT("AIBaseCharacter::UpdateBloodMask: Failed to create texture."));
-		return;
+		BuildBloodMaskRegions(BloodMaskPixelData, CachedWoundValues, BloodMaskRegions);
 	}
 
-	TArray64<uint8>* Pixels = new TArray64<uint8>();
-
-	Pixels->Reserve(BloodMaskPixelData.Pixels.Num());
-	uint8* const PixelArrayStart = Pixels->GetData();
-
-	for (int32 y = 0; y < BloodMaskPixelData.TextureSize.Y; y++)
+	// Keep writing into our own texture while the mask size stays the same
+	const FIntPoint TextureSize((int32)BloodMaskPixelData.TextureSize.X, (int32)BloodMaskPixelData.TextureSize.Y);
+	UTexture2DDynamic* Texture = BloodMask;
+	if (!Texture || Texture->SizeX != TextureSize.X || Texture->SizeY != TextureSize.Y)
 	{
-		for (int32 x = 0; x < BloodMaskPixelData.TextureSize.X; x++)
+		Texture = FBloodMaskTexturePool::Get().Acquire(TextureSize);
+		if (!Texture)
 		{
-			// Get the current pixel
-			const int32 CurrentPixelIndex = ((y * BloodMaskPixelData.TextureSize.X) + x) * 4;
-
-			const uint8 SourceB = BloodMaskPixelData.Pixels[CurrentPixelIndex];
-			const uint8 SourceG = BloodMaskPixelData.Pixels[CurrentPixelIndex + 1];
-			const uint8 SourceR = BloodMaskPixelData.Pixels[CurrentPixelIndex + 2];
-
-			const uint8 FinalOpacity = GetWoundOpacity(SourceB, SourceG, SourceR);
-					
-			PixelArrayStart[CurrentPixelIndex] = FinalOpacity; // B
-			PixelArrayStart[CurrentPixelIndex + 1] = FinalOpacity; // G
-			PixelArrayStart[CurrentPixelIndex + 2] = FinalOpacity; // R
-			PixelArrayStart[CurrentPixelIndex + 3] = 255; // A
+			UE_LOG(LogTemp, Error, TEXT("AIBaseCharacter::UpdateBloodMask: Failed to create texture."));
+			return;
 		}
 	}
 
-	
-
-	NewTexture->CompressionSettings = TC_VectorDisplacementmap;
-	NewTexture->UpdateResource();
+	TArray64<uint8>* Pixels = new TArray64<uint8>();
+	FillBloodMaskPixels(BloodMaskRegions, CachedWoundValues, *Pixels);
 
 	ENQUEUE_RENDER_COMMAND(FWriteRawDataToTexture)(
-	[NewTexture, Pixels](FRHICommandListImmediate& RHICmdList)
+	[Texture, Pixels](FRHICommandListImmediate& RHICmdList)
 	{
-		if (NewTexture)
+		if (Texture)
 		{
-			FTexture2DDynamicResource* TextureResource = static_cast<FTexture2DDynamicResource*>(NewTexture->GetResource());
+			FTexture2DDynamicResource* TextureResource = static_cast<FTexture2DDynamicResource*>(Texture->GetResource());
 			if (TextureResource)
 			{
 				WriteRawToTexture_RenderThread(TextureResource, Pixels);
@@ -552,16 +804,15 @@ void AIBaseCharacter::UpdateBloodMask(bool bForceUpdate)
 		}
 	});
 
-
 	// Swap textures out
 	UTexture2DDynamic* OldTexture = BloodMask;
-	BloodMask = NewTexture;
+	BloodMask = Texture;
 
 	UpdateWoundsTextures();
 
-	if (OldTexture)
+	if (OldTexture && OldTexture != Texture)
 	{
-		OldTexture->ConditionalBeginDestroy();
+		FBloodMaskTexturePool::Get().Release(OldTexture);
 		OldTexture = nullptr;
 	}
 
@@ -2643,6 +2894,19 @@ void AIBaseCharacter::BeginDestroy()
 	Super::BeginDestroy();
 }
 
+void AIBaseCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+#if !UE_SERVER
+	if (BloodMask)
+	{
+		FBloodMaskTexturePool::Get().Release(BloodMask);
+		BloodMask = nullptr;
+	}
+#endif
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AIBaseCharacter::OnConstruction(const FTransform& Transform)
 {
 	Super::OnConstruction(Transform);
@@ -7100,8 +7364,16 @@ void AIBaseCharacter::UpdateFocusAndAimRotation(const float DeltaSeconds)
 	if (!bLockDesiredFocalPoint)
 	{
 		TraceEnd = TraceStart + (ViewPointRot.Vector() * GetGrowthFocusTargetDistance());
-	
-		ProcessFocusTargets(TraceStart, TraceEnd, FCollisionShape::MakeSphere(FocusTargetRadius), TargetFocalPointLocation, DeltaSeconds, false);
+
+		if (ShouldRunFocusSweep(TraceStart, ViewPointRot))
+		{
+			bFocusSweepHitPawn = false;
+			ProcessFocusTargets(TraceStart, TraceEnd, FCollisionShape::MakeSphere(FocusTargetRadius), TargetFocalPointLocation, DeltaSeconds, false);
+
+			// Jitter the interval so several local characters don't all land their sweeps on the same frame
+			const float Interval = bFocusSweepHitPawn ? CVarFocusSweepInterval.GetValueOnGameThread() : CVarFocusSweepIdleInterval.GetValueOnGameThread();
+			NextFocusSweepTime = GetWorld()->GetTimeSeconds() + Interval * FMath::FRandRange(0.75f, 1.25f);
+		}
 	}
 	
 	if (!IsValid(TargetFocalPointComponent) && TargetFocalPointComponent)
@@ -7157,6 +7429,43 @@ void AIBaseCharacter::UpdateFocusAndAimRotation(const float DeltaSeconds)
 #endif
 }
 
+bool AIBaseCharacter::ShouldRunFocusSweep(const FVector& TraceStart, const FRotator& ViewPointRot)
+{
+	const float Now = GetWorld()->GetTimeSeconds();
+	const bool bCarrying = IsCarryingObject();
+
+	bool bRunSweep = CVarFocusSweepThrottle.GetValueOnGameThread() == 0
+		|| bIsAbilityInputDisabled
+		|| Now >= NextFocusSweepTime
+		|| bCarrying != bLastFocusSweepCarrying
+		// whatever we were focused on went away, don't keep outlining it until the next sweep
+		|| (DesiredTargetFocalPointComponent && !IsValid(DesiredTargetFocalPointComponent))
+		|| (!FocusedObject.Object.IsExplicitlyNull() && !FocusedObject.Object.IsValid());
+
+	if (!bRunSweep)
+	{
+		const float MoveThreshold = CVarFocusSweepMoveThreshold.GetValueOnGameThread();
+		const float AngleThreshold = CVarFocusSweepAngleThreshold.GetValueOnGameThread();
+
+		bRunSweep = FVector::DistSquared(TraceStart, LastFocusSweepStart) > FMath::Square(MoveThreshold)
+			|| !ViewPointRot.Equals(LastFocusSweepRotation, AngleThreshold);
+	}
+
+	if (!bRunSweep)
+	{
+		INC_DWORD_STAT(STAT_FocusSweepsSkipped);
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_FocusSweepsRun);
+
+	LastFocusSweepStart = TraceStart;
+	LastFocusSweepRotation = ViewPointRot;
+	bLastFocusSweepCarrying = bCarrying;
+
+	return true;
+}
+
 void AIBaseCharacter::ProcessFocusTargets(FVector TraceStart, FVector TraceEnd, FCollisionShape Shape, FVector &TargetFocalPointLocation, const float DeltaSeconds, bool bForceReset /* = false*/)
 {
 	if (bIsAbilityInputDisabled) 
@@ -7177,6 +7486,15 @@ void AIBaseCharacter::ProcessFocusTargets(FVector TraceStart, FVector TraceEnd,
 	TArray<FHitResult> FocusHitResults;
 	GetWorld()->SweepMultiByChannel(FocusHitResults, TraceStart, TraceEnd, FQuat::Identity, TRACE_FOCUSTARGET, Shape, QueryParams);
 
+	for (const FHitResult& HitResult : FocusHitResults)
+	{
+		if (Cast<APawn>(HitResult.GetActor()))
+		{
+			bFocusSweepHitPawn = true;
+			break;
+		}
+	}
+
 	//need to know if there's a blocking hit
 	float DistanceToBlockingHit = -1.f;
 	AActor* BlockingHitActor = nullptr;
@@ -15334,19 +15652,20 @@ bool AIBaseCharacter::QueueShapeTraces(UWorld* World, const TArray<FTimedTraceBo
 		}
 	}
 
-	if (TraceSet.Items.Num() > 0)
+	const bool bQueuedTraces = TraceSet.Items.Num() > 0;
+	if (bQueuedTraces)
 	{
-		QueueTraces(TraceSet);
+		QueueTraces(MoveTemp(TraceSet));
 	}
 
 	PreviousBoneData = NextBoneData;
 
-	return TraceSet.Items.Num() > 0;
+	return bQueuedTraces;
 }
 
-void AIBaseCharacter::QueueTraces(const FQueuedTraceSet& QueueSet)
+void AIBaseCharacter::QueueTraces(FQueuedTraceSet&& QueueSet)
 {
-	FWeaponTraceWorker::Get()->QueueTraces(QueueSet);
+	FWeaponTraceWorker::Get()->QueueTraces(MoveTemp(QueueSet));
 }
 
 void AIBaseCharacter::UpdateOverlaps(float DeltaTime)
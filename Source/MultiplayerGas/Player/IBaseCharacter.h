@@ -670,6 +670,15 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void UpdateBloodMask(bool bForceUpdate = false);
 
+	// Wound region of every blood mask pixel, 1 + its index in WoundValues or 0 where no wound colour matches
+	static void BuildBloodMaskRegions(const FBloodMaskPixelData& PixelData, const TArray<FCachedWoundDamage>& WoundValues, TArray<uint8>& OutRegions);
+
+	// Writes the BGRA blood mask for the current wound opacities, one opacity lookup per pixel
+	static void FillBloodMaskPixels(const TArray<uint8>& Regions, const TArray<FCachedWoundDamage>& WoundValues, TArray64<uint8>& OutPixels);
+
+	// Fills a synthetic blood mask with the per pixel colour search and with the region lookup, checks both produce the same pixels
+	static FString BenchmarkBloodMask(int32 Iterations);
+
 	UPROPERTY(Config)
 	bool bWoundsEnabled;
 
@@ -768,6 +777,9 @@ public:
 	UPROPERTY(VisibleDefaultsOnly)
 	FBloodMaskPixelData BloodMaskPixelData;
 
+	// Built from BloodMaskPixelData on the first mask update
+	TArray<uint8> BloodMaskRegions;
+
 	// Interactive Foliage
 protected:
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = IBaseCharacter)
@@ -1674,6 +1686,8 @@ public:
 
 	virtual void BeginDestroy() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void OnConstruction(const FTransform& Transform) override;
 
 	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
@@ -3359,6 +3373,18 @@ protected:
 
 	virtual void ProcessFocusTargets(FVector TraceStart, FVector TraceEnd, FCollisionShape Shape, FVector &TargetFocalPointLocation, const float DeltaSeconds, bool bForceReset = false);
 
+	// Whether the focus sweep has to run this frame, skipped while the view is still until the pot.FocusSweep* interval runs out
+	bool ShouldRunFocusSweep(const FVector& TraceStart, const FRotator& ViewPointRot);
+
+	// View the last focus sweep was run from
+	FVector LastFocusSweepStart = FVector::ZeroVector;
+	FRotator LastFocusSweepRotation = FRotator::ZeroRotator;
+	float NextFocusSweepTime = -1.0f;
+
+	// Set by ProcessFocusTargets when the sweeps hit another pawn, still views re-sweep at the faster interval while it's set
+	bool bFocusSweepHitPawn = false;
+	bool bLastFocusSweepCarrying = false;
+
 	virtual void EvaluateFocusFromLocation(FVector& OutFocusFromLocation) const;
 
 	UPROPERTY(BlueprintReadOnly, Category = "Focus")
@@ -4522,7 +4548,7 @@ protected:
 
 	bool QueueShapeTraces(UWorld* World, const TArray<FTimedTraceBoneGroup> SectionBones, const FCollisionQueryParams& TraceParams, const float CurrentMontageTime, const float DeltaTime, bool bStopOnBlock = true);
 
-	void QueueTraces(const FQueuedTraceSet& QueueSet);
+	void QueueTraces(FQueuedTraceSet&& QueueSet);
 
 	bool WaPShape2UCollision(FCollisionShape& OutShape, const FPhysicsShapeHandle& ShapeHandle) const;
 
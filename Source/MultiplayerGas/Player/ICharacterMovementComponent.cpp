@@ -11,9 +11,12 @@
 #include "Stats/IStats.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Components/StateAdjustableCapsuleComponent.h"
+#include "Components/PawnProximityGrid.h"
+#include "EngineUtils.h"
 #include "GameFramework/GameNetworkManager.h"
 #include "DrawDebugHelpers.h"
 #include "MultiCapsuleTraceWorker.h"
+#include "Components/MultiCapsuleSweepBatcher.h"
 #include "Abilities/CoreAttributeSet.h"
 #include "Abilities/POTAbilitySystemComponent.h"
 #include "Engine/World.h"
@@ -25,9 +28,19 @@
 #include "Online/IGameSession.h"
 #include "Online/IGameState.h"
 #include "IWorldSettings.h"
+#include "Engine/NetSerialization.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogICharacterMovement, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("SituationalAuthority"), STATGROUP_SituationalAuthority, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Physics Overlaps Avoided"), STAT_SituationalAuthorityOverlapsAvoided, STATGROUP_SituationalAuthority);
+
+DECLARE_STATS_GROUP(TEXT("SavedMoves"), STATGROUP_SavedMoves, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Moves Allocated"), STAT_SavedMovesAllocated, STATGROUP_SavedMoves);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Moves Combined Relaxed"), STAT_SavedMovesCombinedRelaxed, STATGROUP_SavedMoves);
+
 // CVars
 namespace ICharacterMovementCVars
 {
@@ -65,6 +78,36 @@ namespace ICharacterMovementCVars
 		TEXT("If > 0 CMC will consider the character to always be moving forward. \n"),
 		ECVF_Cheat);
 
+	static TAutoConsoleVariable<bool> CVarBatchMultiCapsuleSweeps(
+		TEXT("pot.BatchMultiCapsuleSweeps"),
+		true,
+		TEXT("If true, async additional capsule sweeps of all characters go through the world's async trace batch, swimming included. Otherwise they use the multi capsule trace worker. \n"),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<bool> CVarSituationalAuthorityGrid(
+		TEXT("pot.SituationalAuthorityGrid"),
+		true,
+		TEXT("If true, situational authority looks for nearby dinosaurs in the pawn proximity grid instead of running a physics overlap. \n"),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarPawnProximityGridCellSize(
+		TEXT("pot.PawnProximityGridCellSize"),
+		2000.0f,
+		TEXT("Cell size in uu of the pawn proximity grid used by situational authority. \n"),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<bool> CVarRelaxedMoveCombining(
+		TEXT("pot.RelaxedMoveCombining"),
+		true,
+		TEXT("If true, saved moves that only differ in aim or precise rotate to direction by less than pot.MoveCombineAimTolerance are combined and not sent as important moves. \n"),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarMoveCombineAimTolerance(
+		TEXT("pot.MoveCombineAimTolerance"),
+		2.0f,
+		TEXT("Degrees the aim of two saved moves, and their input relative to the aim, may differ by to still be combined. \n"),
+		ECVF_Default);
+
 	static TAutoConsoleVariable<bool> CVarApproximateValidation(
 		TEXT("pot.ApproximateMovementValidation"),
 		false,
@@ -1050,6 +1093,8 @@ void UICharacterMovementComponent::DisableAdditionalCapsules(bool bPermanentlyIg
 			}
 		}
 	}
+
+	InvalidateCachedHits();
 }
 
 void UICharacterMovementComponent::EnableAdditionalCapsules()
@@ -1061,6 +1106,8 @@ void UICharacterMovementComponent::EnableAdditionalCapsules()
 			AC->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
 		}
 	}
+
+	InvalidateCachedHits();
 }
 
 const TArray<UCapsuleComponent*>& UICharacterMovementComponent::GetAdditionalCapsules()
@@ -3604,6 +3651,7 @@ void UICharacterMovementComponent::RegisterCapsulesAsAdditionalComponent(TArray<
 		}
 	}
 
+	CachedHits.Reset(AdditionalCapsules.Num());
 }
 
 //Automatically fetch non-root capsules. Called in BeginPlay
@@ -3666,6 +3714,7 @@ void UICharacterMovementComponent::GatherAdditionalUpdatedComponents()
 		AdditionalCapsuleDefaultCollisionProfiles.Add(MainCapsule, FStoredCollisionInfo(MainCapsule->GetCollisionObjectType(), MainCapsule->GetCollisionEnabled(), MainCapsule->GetCollisionResponseToChannels()));
 	}
 
+	CachedHits.Reset(AdditionalCapsules.Num());
 }
 
 //Basically a copy of the default function from the CMC with the addition of simulating the other capsules and adjusting for those
@@ -3931,6 +3980,14 @@ bool UICharacterMovementComponent::MoveAdditionalCapsules(const FVector& Delta,
 	TArray<const UCapsuleComponent*> BlockedComponents;
 	LastHitComponent = nullptr;
 
+	// Skins and growth stages can swap the mesh, which moves and resizes the capsules attached to it
+	const USkeletalMesh* const CurrentMesh = CharacterOwner->GetMesh()->GetSkeletalMeshAsset();
+	if (CachedHitsMesh.Get() != CurrentMesh)
+	{
+		InvalidateCachedHits();
+		CachedHitsMesh = CurrentMesh;
+	}
+
 	//Disable mesh overlap for the duration of this.
 	CharacterOwner->GetCapsuleComponent()->SetGenerateOverlapEvents(false);
 	CharacterOwner->GetMesh()->SetGenerateOverlapEvents(false);
@@ -3957,7 +4014,7 @@ bool UICharacterMovementComponent::MoveAdditionalCapsules(const FVector& Delta,
 			if (ShouldUseAsyncMultiCapsuleCollision(AC))
 			{
 
-				if (const FHitResult* HResult = CachedHits.Find(AC))
+				if (const FHitResult* HResult = CachedHits.Find(i))
 				{
 					if (HResult->bBlockingHit)
 					{
@@ -3973,9 +4030,16 @@ bool UICharacterMovementComponent::MoveAdditionalCapsules(const FVector& Delta,
 				FCollisionResponseParams ResponseParams;
 				CalculateSweepData(AC, Delta, NewRotation, TraceStart, TraceEnd, NewCompQuat, QueryParams, ResponseParams);
 
-				FMultiCapsuleTraceWorker::Get()->QueueTraces(
-					FQueuedMultiCapsuleTrace(GetWorld(), Cast<AIBaseCharacter>(CharacterOwner), AC, TraceStart,
-						TraceEnd, Delta, NewCompQuat, QueryParams, ResponseParams, MoveComponentFlags));
+				if (ICharacterMovementCVars::CVarBatchMultiCapsuleSweeps->GetBool())
+				{
+					FMultiCapsuleSweepBatcher::Get().QueueSweep(this, AC, i, TraceStart, TraceEnd, Delta, NewCompQuat, QueryParams, ResponseParams, MoveComponentFlags);
+				}
+				else
+				{
+					FMultiCapsuleTraceWorker::Get()->QueueTraces(
+						FQueuedMultiCapsuleTrace(GetWorld(), Cast<AIBaseCharacter>(CharacterOwner), AC, TraceStart,
+							TraceEnd, Delta, NewCompQuat, QueryParams, ResponseParams, MoveComponentFlags));
+				}
 			}
 			else
 			{
@@ -3986,8 +4050,7 @@ bool UICharacterMovementComponent::MoveAdditionalCapsules(const FVector& Delta,
 					BlockedHits.Add(BlockedHit);
 					BlockedComponents.Add(AC);
 
-					FHitResult& ComponentResult = CachedHits.FindOrAdd(AC);
-					ComponentResult = BlockedHit;
+					CachedHits.Store(i) = BlockedHit;
 				}
 			}
 
@@ -4424,6 +4487,12 @@ void UICharacterMovementComponent::SetMovementMode(EMovementMode NewMovementMode
 			}
 		}
 
+		// Hits cached against the ground don't apply in water and the other way around
+		if ((MovementMode == MOVE_Swimming) != (NewMovementMode == MOVE_Swimming))
+		{
+			InvalidateCachedHits();
+		}
+
 		Super::SetMovementMode(NewMovementMode, NewCustomMode);
 	}
 }
@@ -4646,7 +4715,7 @@ bool UICharacterMovementComponent::AdditionalCapsuleComponentSweepMulti(TArray<s
 	bool bDoTest = bTestTraceIfNoBlocking;
 	if (bDoTest)
 	{
-		if (const FHitResult* HResult = CachedHits.Find(PrimComp))
+		if (const FHitResult* HResult = CachedHits.Find(FindCapsuleOrdinal(PrimComp)))
 		{
 			bDoTest = !HResult->bBlockingHit;
 		}
@@ -4669,22 +4738,659 @@ bool UICharacterMovementComponent::AdditionalCapsuleComponentSweepMulti(TArray<s
 
 void UICharacterMovementComponent::ProcessCompletedAsyncSweepMulti(const FQueuedMultiCapsuleTrace& CompletedTrace)
 {
+	const UPrimitiveComponent* const PrimComp = CompletedTrace.PrimComp.Get();
+	CacheAsyncSweepHits(FindCapsuleOrdinal(PrimComp), PrimComp, CompletedTrace.OutHits, CompletedTrace.Start, CompletedTrace.End, CompletedTrace.NewDelta, CompletedTrace.MoveFlags);
+}
+
+void UICharacterMovementComponent::ProcessCompletedBatchedSweep(const FBatchedCapsuleSweep& CompletedSweep, const UPrimitiveComponent* Capsule, int32 CapsuleIndex, const TArray<FHitResult>& Hits)
+{
+	// The capsule set may have been gathered again while the sweep was in flight
+	const int32 CapsuleOrdinal = AdditionalCapsules.IsValidIndex(CapsuleIndex) && AdditionalCapsules[CapsuleIndex] == Capsule ? CapsuleIndex : FindCapsuleOrdinal(Capsule);
+	CacheAsyncSweepHits(CapsuleOrdinal, Capsule, Hits, CompletedSweep.Start, CompletedSweep.End, CompletedSweep.Delta, CompletedSweep.MoveFlags);
+}
+
+void UICharacterMovementComponent::CacheAsyncSweepHits(int32 CapsuleOrdinal, const UPrimitiveComponent* PrimComp, const TArray<FHitResult>& Hits, const FVector& Start, const FVector& End, const FVector& NewDelta, EMoveComponentFlags MoveFlags)
+{
+	if (CapsuleOrdinal == INDEX_NONE)
+	{
+		return;
+	}
+
 	TArray<FHitResult> BlockedHits;
-	TArray<const UPrimitiveComponent*> BlockedComponents;
 
-	for (const FHitResult& Hit : CompletedTrace.OutHits)
+	for (const FHitResult& Hit : Hits)
 	{
 		if (Hit.bBlockingHit)
 		{
 			BlockedHits.Add(Hit);
-			BlockedComponents.Add(CompletedTrace.PrimComp.Get());
 		}
 	}
-	
 
-	FHitResult& ComponentResult = CachedHits.FindOrAdd(CompletedTrace.PrimComp.Get());
+	FHitResult& ComponentResult = CachedHits.Store(CapsuleOrdinal);
 	ComponentResult.Init();
-	ProcessHits(BlockedHits.Num() > 0, BlockedHits, CompletedTrace.Start, CompletedTrace.End, CompletedTrace.NewDelta, CompletedTrace.PrimComp.Get(), CompletedTrace.MoveFlags, &ComponentResult);
+	ProcessHits(BlockedHits.Num() > 0, BlockedHits, Start, End, NewDelta, PrimComp, MoveFlags, &ComponentResult);
+}
+
+void FCapsuleHitCache::Reset(int32 NumCapsules)
+{
+	Hits.SetNum(NumCapsules);
+	Valid.Init(false, NumCapsules);
+}
+
+void FCapsuleHitCache::Invalidate()
+{
+	Valid.SetRange(0, Valid.Num(), false);
+}
+
+const FHitResult* FCapsuleHitCache::Find(int32 Ordinal) const
+{
+	return Valid.IsValidIndex(Ordinal) && Valid[Ordinal] ? &Hits[Ordinal] : nullptr;
+}
+
+FHitResult& FCapsuleHitCache::Store(int32 Ordinal)
+{
+	// Every capsule set change resizes the cache, so this only grows if a capsule got added behind our back
+	if (!ensure(Hits.IsValidIndex(Ordinal)))
+	{
+		Valid.Add(false, Ordinal + 1 - Hits.Num());
+		Hits.SetNum(Ordinal + 1);
+	}
+
+	Valid[Ordinal] = true;
+	return Hits[Ordinal];
+}
+
+int32 UICharacterMovementComponent::FindCapsuleOrdinal(const UPrimitiveComponent* PComp) const
+{
+	if (PComp == nullptr)
+	{
+		return INDEX_NONE;
+	}
+
+	// A handful of capsules per character, a linear search beats hashing
+	for (int32 Index = 0; Index < AdditionalCapsules.Num(); Index++)
+	{
+		if (AdditionalCapsules[Index] == PComp)
+		{
+			return Index;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+void UICharacterMovementComponent::InvalidateCachedHits()
+{
+	CachedHits.Invalidate();
+}
+
+// Benchmarks move stand-ins of a connected player's character class rather than the player's own pawn
+static ACharacter* SpawnBenchmarkStandIn(UWorld* World, TSubclassOf<ACharacter> CharacterClass, int32 Index)
+{
+	if (!World || !CharacterClass)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags |= RF_Transient;
+
+	// Far below the map and apart from each other, so their sweeps only find each other's capsules if nothing
+	const FVector Location((Index % 32) * 5000.0f, (Index / 32) * 5000.0f, -1000000.0f);
+	return World->SpawnActor<ACharacter>(CharacterClass, Location, FRotator::ZeroRotator, SpawnParams);
+}
+
+FString UICharacterMovementComponent::BenchmarkCachedHits(ACharacter* TemplateCharacter, int32 SimulatedMinutes)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UICharacterMovementComponent::BenchmarkCachedHits"))
+
+	UWorld* const World = TemplateCharacter ? TemplateCharacter->GetWorld() : nullptr;
+	if (!World)
+	{
+		return TEXT("CachedHits: needs a spawned character to copy the soak characters from");
+	}
+
+	SimulatedMinutes = FMath::Clamp(SimulatedMinutes, 1, 600);
+
+	// A full server of characters, each moving once a simulated second.
+	// The cache holds one hit per capsule, so its memory depends on the capsule set changes and invalidations rather than the move rate
+	static const int32 NumCharacters = 300;
+	static const int32 GrowthChangeEverySeconds = 60;
+	static const int32 CapsuleSetChangeEverySeconds = 300;
+	static const float MoveDistance = 60.0f;
+
+	struct FSoakCharacter
+	{
+		ACharacter* Character = nullptr;
+		UICharacterMovementComponent* Movement = nullptr;
+		TArray<UCapsuleComponent*> Capsules;
+		int32 RemovableCapsuleIndex = INDEX_NONE;
+	};
+
+	TArray<FSoakCharacter> SoakCharacters;
+	SoakCharacters.Reserve(NumCharacters);
+
+	for (int32 Index = 0; Index < NumCharacters; Index++)
+	{
+		ACharacter* const Character = SpawnBenchmarkStandIn(World, TemplateCharacter->GetClass(), Index);
+		UICharacterMovementComponent* const Movement = Character ? Cast<UICharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+		if (!Movement || !Movement->bUseMultiCapsuleCollision || Movement->AdditionalCapsules.Num() < 2)
+		{
+			if (Character)
+			{
+				Character->Destroy();
+			}
+			break;
+		}
+
+		// Sweep on the game thread so every hit lands in the cache during the run instead of next frame
+		Movement->AsyncCollisionMode = 0;
+		Movement->bForceAsyncMCC = false;
+
+		FSoakCharacter& SoakCharacter = SoakCharacters.AddDefaulted_GetRef();
+		SoakCharacter.Character = Character;
+		SoakCharacter.Movement = Movement;
+		SoakCharacter.Capsules = Movement->AdditionalCapsules;
+
+		// Every other capsule set change leaves out the first capsule that isn't the root
+		SoakCharacter.RemovableCapsuleIndex = SoakCharacter.Capsules.IndexOfByPredicate([Movement](const UCapsuleComponent* Capsule)
+		{
+			return Capsule != Movement->UpdatedComponent;
+		});
+	}
+
+	if (SoakCharacters.Num() < NumCharacters)
+	{
+		for (const FSoakCharacter& SoakCharacter : SoakCharacters)
+		{
+			SoakCharacter.Character->Destroy();
+		}
+		return TEXT("CachedHits: needs a character class with additional movement capsules");
+	}
+
+	auto GetCacheSize = [&SoakCharacters]()
+	{
+		SIZE_T Size = 0;
+		for (const FSoakCharacter& SoakCharacter : SoakCharacters)
+		{
+			Size += SoakCharacter.Movement->CachedHits.GetAllocatedSize();
+		}
+		return Size;
+	};
+
+	const SIZE_T StartSize = GetCacheSize();
+	SIZE_T MaxSize = StartSize;
+	const uint64 StartUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	uint64 MaxUsedPhysical = StartUsedPhysical;
+
+	FRandomStream Random(12345);
+	int64 NumBlocked = 0;
+	int32 NumInvalidations = 0;
+	int32 NumCapsuleSetChanges = 0;
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Minute = 0; Minute < SimulatedMinutes; Minute++)
+	{
+		for (int32 Second = 0; Second < 60; Second++)
+		{
+			const int32 SecondIndex = Minute * 60 + Second;
+			const bool bCapsuleSetChange = SecondIndex > 0 && SecondIndex % CapsuleSetChangeEverySeconds == 0;
+			const bool bGrowthChange = !bCapsuleSetChange && SecondIndex > 0 && SecondIndex % GrowthChangeEverySeconds == 0;
+
+			for (FSoakCharacter& SoakCharacter : SoakCharacters)
+			{
+				UICharacterMovementComponent* const Movement = SoakCharacter.Movement;
+
+				// Mesh swaps and registered capsules change the set, growth only the capsules' size
+				if (bCapsuleSetChange && SoakCharacter.RemovableCapsuleIndex != INDEX_NONE)
+				{
+					Movement->AdditionalCapsules = SoakCharacter.Capsules;
+					if (NumCapsuleSetChanges % 2 == 0)
+					{
+						Movement->AdditionalCapsules.RemoveAt(SoakCharacter.RemovableCapsuleIndex);
+					}
+					Movement->CachedHits.Reset(Movement->AdditionalCapsules.Num());
+				}
+				else if (bGrowthChange)
+				{
+					Movement->InvalidateCachedHits();
+				}
+
+				// Sweeps only, the capsules stay where they are
+				const FVector Delta = FVector(Random.GetUnitVector().GetSafeNormal2D() * MoveDistance);
+				FHitResult Hit(1.f);
+				NumBlocked += Movement->MoveAdditionalCapsules(Delta, Movement->UpdatedComponent->GetComponentQuat(), &Hit) ? 1 : 0;
+			}
+
+			NumCapsuleSetChanges += bCapsuleSetChange ? 1 : 0;
+			NumInvalidations += bGrowthChange ? 1 : 0;
+		}
+
+		MaxSize = FMath::Max(MaxSize, GetCacheSize());
+		MaxUsedPhysical = FMath::Max(MaxUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+	}
+	const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+	const SIZE_T EndSize = GetCacheSize();
+	const uint64 EndUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+
+	const int32 NumCapsules = SoakCharacters[0].Capsules.Num();
+	for (const FSoakCharacter& SoakCharacter : SoakCharacters)
+	{
+		SoakCharacter.Character->Destroy();
+	}
+
+	const int64 NumMoves = static_cast<int64>(SimulatedMinutes) * 60 * NumCharacters;
+	const FString Summary = FString::Printf(TEXT("CachedHits: %d characters x %d capsules, %d simulated minutes, %lld moves in %.3fs (%.1fus per move, %lld blocked), %d growth invalidations, %d capsule set changes. Cache memory start %llu bytes, peak %llu bytes, end %llu bytes. Process used physical start %.1fMB, peak %.1fMB, end %.1fMB"),
+		NumCharacters, NumCapsules, SimulatedMinutes, NumMoves, Seconds, Seconds * 1.0e6 / FMath::Max<int64>(NumMoves, 1), NumBlocked, NumInvalidations, NumCapsuleSetChanges,
+		static_cast<uint64>(StartSize), static_cast<uint64>(MaxSize), static_cast<uint64>(EndSize),
+		StartUsedPhysical / (1024.0 * 1024.0), MaxUsedPhysical / (1024.0 * 1024.0), EndUsedPhysical / (1024.0 * 1024.0));
+
+	UE_LOG(LogICharacterMovement, Log, TEXT("UICharacterMovementComponent::BenchmarkCachedHits: %s"), *Summary);
+
+	return Summary;
+}
+
+FString UICharacterMovementComponent::BenchmarkMoveCombining(ACharacter* Character, int32 NumSeconds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UICharacterMovementComponent::BenchmarkMoveCombining"))
+
+	const UICharacterMovementComponent* const Movement = Character ? Cast<UICharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+	if (!Movement || !Cast<AIBaseCharacter>(Character))
+	{
+		return TEXT("MoveCombining: needs a spawned character to replay the moves with");
+	}
+
+	NumSeconds = FMath::Clamp(NumSeconds, 1, 3600);
+
+	// Client frame rate the inputs were recorded at and the rate the client sends moves at
+	static const int32 FramesPerSecond = 120;
+	static const float FrameDeltaTime = 1.0f / FramesPerSecond;
+	static const float SendMoveDeltaTime = 1.0f / 60.0f;
+
+	const APlayerState* const PlayerState = Character->GetPlayerState();
+	const float RoundTripSeconds = FMath::Max(PlayerState ? PlayerState->GetPingInMilliseconds() / 1000.0f : 0.0f, 0.1f);
+
+	struct FRecordedInput
+	{
+		FVector Acceleration = FVector::ZeroVector;
+		FRotator ControlRotation = FRotator::ZeroRotator;
+		bool bWantsToSprint = false;
+		bool bWantsToPreciseMove = false;
+		bool bRotateToDirection = false;
+	};
+
+	// Running around with the aim trailing the input by a degree or so, the odd look around, sprint toggles and stretches of precise movement
+	TArray<FRecordedInput> Inputs;
+	Inputs.Reserve(NumSeconds * FramesPerSecond);
+
+	FRandomStream Random(4242);
+	float Heading = 0.0f;
+	float LookAround = 0.0f;
+	bool bWantsToSprint = false;
+	for (int32 Frame = 0; Frame < NumSeconds * FramesPerSecond; Frame++)
+	{
+		Heading += Random.FRandRange(-0.3f, 0.3f);
+		LookAround = Random.FRand() < 0.005f ? Random.FRandRange(-40.0f, 40.0f) : LookAround * 0.98f;
+		if (Random.FRand() < 0.003f)
+		{
+			bWantsToSprint = !bWantsToSprint;
+		}
+
+		const float AimYaw = Heading + LookAround + Random.FRandRange(-0.5f, 0.5f);
+
+		FRecordedInput& Input = Inputs.AddDefaulted_GetRef();
+		Input.Acceleration = FRotator(0.0f, Heading, 0.0f).Vector() * Movement->GetMaxAcceleration();
+		Input.ControlRotation = FRotator(-10.0f + Random.FRandRange(-0.5f, 0.5f), AimYaw, 0.0f).Clamp();
+		Input.bWantsToSprint = bWantsToSprint;
+		Input.bWantsToPreciseMove = (Frame / (10 * FramesPerSecond)) % 4 == 3;
+
+		// Same rule the client uses in PhysicsRotation to start rotating to the input direction
+		const float InputAimDifference = FMath::Abs(FMath::FindDeltaAngleDegrees(Heading, AimYaw));
+		Input.bRotateToDirection = InputAimDifference > 0.1f && InputAimDifference <= 50.0f;
+	}
+
+	struct FReplayResult
+	{
+		int32 MovesSent = 0;
+		int32 MovesCombined = 0;
+		int32 ImportantMoves = 0;
+		int32 MovesAllocated = 0;
+		int32 PoolSize = 0;
+		int32 ServerMovesPerformed = 0;
+		int32 Corrections = 0;
+		double ClientSeconds = 0.0;
+		double ServerSeconds = 0.0;
+	};
+
+	// Emulates ReplicateMoveToServer on a client stand-in: moves are set up, combined, performed and saved the way the engine does,
+	// held back until the send rate allows and acked a round trip later. Every packet is performed by a second stand-in's ServerMove_PerformMovement.
+	auto ReplayInputs = [&](bool bRelaxed)
+	{
+		ICharacterMovementCVars::CVarRelaxedMoveCombining->Set(bRelaxed, ECVF_SetByConsole);
+
+		FReplayResult Result;
+
+		ACharacter* const ClientCharacter = SpawnBenchmarkStandIn(Character->GetWorld(), Character->GetClass(), 0);
+		ACharacter* const ServerCharacter = SpawnBenchmarkStandIn(Character->GetWorld(), Character->GetClass(), 1);
+		UICharacterMovementComponent* const ClientMovement = ClientCharacter ? Cast<UICharacterMovementComponent>(ClientCharacter->GetCharacterMovement()) : nullptr;
+		UICharacterMovementComponent* const ServerMovement = ServerCharacter ? Cast<UICharacterMovementComponent>(ServerCharacter->GetCharacterMovement()) : nullptr;
+		ON_SCOPE_EXIT
+		{
+			if (ClientCharacter)
+			{
+				ClientCharacter->Destroy();
+			}
+			if (ServerCharacter)
+			{
+				ServerCharacter->Destroy();
+			}
+		};
+
+		if (!ClientMovement || !ServerMovement)
+		{
+			return Result;
+		}
+
+		// Nothing to stand on off-map, both fly at walking speed so they don't fall out of the world
+		for (UICharacterMovementComponent* const StandInMovement : { ClientMovement, ServerMovement })
+		{
+			StandInMovement->MaxFlySpeed = StandInMovement->MaxWalkSpeed;
+			StandInMovement->SetMovementMode(MOVE_Flying);
+		}
+
+		// The stand-ins are spawned apart, the server checks the client's locations as if they were its own
+		const FVector ClientToServer = ServerCharacter->GetActorLocation() - ClientCharacter->GetActorLocation();
+
+		FNetworkPredictionData_Client_ICharacter ClientData(*ClientMovement);
+		Result.PoolSize = ClientData.MaxFreeMoveCount;
+
+		const FNetworkPredictionData_Server_Character* const ServerData = ServerMovement->GetPredictionData_Server_Character();
+
+		auto PerformOnServer = [&](const FSavedMove_Character& Move, FCharacterNetworkMoveData::ENetworkMoveType MoveType)
+		{
+			FPOTCharacterNetworkMoveData MoveData;
+			MoveData.ClientFillNetworkMoveData(Move, MoveType);
+			MoveData.Location += ClientToServer;
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			ServerMovement->ServerMove_PerformMovement(MoveData);
+			Result.ServerSeconds += FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+			Result.ServerMovesPerformed++;
+
+			if (MoveType == FCharacterNetworkMoveData::ENetworkMoveType::NewMove && ServerData->PendingAdjustment.TimeStamp == Move.TimeStamp && !ServerData->PendingAdjustment.bAckGoodMove)
+			{
+				Result.Corrections++;
+			}
+		};
+
+		float ClientTime = 0.0f;
+		float LastSendTime = -SendMoveDeltaTime;
+
+		for (const FRecordedInput& Input : Inputs)
+		{
+			ClientTime += FrameDeltaTime;
+
+			while (ClientData.SavedMoves.Num() > 0 && ClientData.SavedMoves[0] != ClientData.PendingMove && ClientData.SavedMoves[0]->TimeStamp + RoundTripSeconds <= ClientTime)
+			{
+				ClientData.FreeMove(ClientData.LastAckedMove);
+				ClientData.LastAckedMove = ClientData.SavedMoves[0];
+				ClientData.SavedMoves.RemoveAt(0, 1, false);
+			}
+
+			FSavedMovePtr NewMove = ClientData.CreateSavedMove();
+			if (!NewMove.IsValid())
+			{
+				continue;
+			}
+
+			const double ClientStartTime = FPlatformTime::Seconds();
+
+			ClientMovement->bWantsToSprint = Input.bWantsToSprint;
+			ClientMovement->bWantsToPreciseMove = Input.bWantsToPreciseMove;
+			ClientMovement->bRotateToDirection = Input.bRotateToDirection;
+
+			ClientData.CurrentTimeStamp = ClientTime;
+			NewMove->SetMoveFor(ClientCharacter, FrameDeltaTime, Input.Acceleration, ClientData);
+
+			// Stand-ins have no controller to take the aim from
+			NewMove->SavedControlRotation = Input.ControlRotation;
+
+			if (ClientData.PendingMove.IsValid() && ClientData.PendingMove->CanCombineWith(NewMove, ClientCharacter, ClientData.MaxMoveDeltaTime))
+			{
+				const FVector OldStartLocation = ClientData.PendingMove->GetRevertedLocation();
+				if (!ClientMovement->OverlapTest(OldStartLocation, ClientData.PendingMove->StartRotation.Quaternion(), ClientMovement->UpdatedComponent->GetCollisionObjectType(), ClientMovement->GetPawnCapsuleCollisionShape(SHRINK_None), ClientCharacter))
+				{
+					NewMove->CombineWith(ClientData.PendingMove.Get(), ClientCharacter, nullptr, OldStartLocation);
+
+					if (ClientData.SavedMoves.Num() > 0 && ClientData.SavedMoves.Last() == ClientData.PendingMove)
+					{
+						ClientData.SavedMoves.Pop(false);
+					}
+					ClientData.FreeMove(ClientData.PendingMove);
+					ClientData.PendingMove = nullptr;
+					Result.MovesCombined++;
+				}
+			}
+
+			ClientMovement->Acceleration = NewMove->Acceleration.GetClampedToMaxSize(ClientMovement->GetMaxAcceleration());
+			ClientMovement->PerformMovement(NewMove->DeltaTime);
+			NewMove->PostUpdate(ClientCharacter, FSavedMove_Character::PostUpdate_Record);
+
+			ClientData.SavedMoves.Push(NewMove);
+
+			Result.ClientSeconds += FPlatformTime::Seconds() - ClientStartTime;
+
+			if (!ClientData.PendingMove.IsValid() && ClientTime - LastSendTime < SendMoveDeltaTime)
+			{
+				ClientData.PendingMove = NewMove;
+				continue;
+			}
+
+			LastSendTime = ClientTime;
+
+			// The oldest unacked move that differs from the acked one is sent again with every packet until it is acked
+			if (ClientData.LastAckedMove.IsValid())
+			{
+				for (int32 MoveIndex = 0; MoveIndex < ClientData.SavedMoves.Num() - 1; MoveIndex++)
+				{
+					if (ClientData.SavedMoves[MoveIndex]->IsImportantMove(ClientData.LastAckedMove))
+					{
+						PerformOnServer(*ClientData.SavedMoves[MoveIndex], FCharacterNetworkMoveData::ENetworkMoveType::OldMove);
+						Result.ImportantMoves++;
+						break;
+					}
+				}
+			}
+
+			// A held back move that couldn't be combined goes out along with the new one
+			if (ClientData.PendingMove.IsValid())
+			{
+				PerformOnServer(*ClientData.PendingMove, FCharacterNetworkMoveData::ENetworkMoveType::PendingMove);
+				ClientData.PendingMove = nullptr;
+				Result.MovesSent++;
+			}
+
+			PerformOnServer(*NewMove, FCharacterNetworkMoveData::ENetworkMoveType::NewMove);
+			Result.MovesSent++;
+		}
+
+		Result.MovesAllocated = ClientData.NumMovesAllocated;
+
+		return Result;
+	};
+
+	const bool bWasRelaxed = ICharacterMovementCVars::CVarRelaxedMoveCombining->GetBool();
+	const FReplayResult Strict = ReplayInputs(false);
+	const FReplayResult Relaxed = ReplayInputs(true);
+	ICharacterMovementCVars::CVarRelaxedMoveCombining->Set(bWasRelaxed, ECVF_SetByConsole);
+
+	if (Strict.ServerMovesPerformed == 0 || Relaxed.ServerMovesPerformed == 0)
+	{
+		return TEXT("MoveCombining: couldn't spawn stand-ins of the character's class to replay the moves with");
+	}
+
+	auto MovesPerSecond = [NumSeconds](const FReplayResult& Result) { return static_cast<double>(Result.MovesSent) / NumSeconds; };
+	auto ServerMicrosecondsPerMove = [](const FReplayResult& Result) { return Result.ServerSeconds * 1.0e6 / Result.ServerMovesPerformed; };
+	auto ServerMillisecondsPerSecond = [NumSeconds](const FReplayResult& Result) { return Result.ServerSeconds * 1000.0 / NumSeconds; };
+
+	const FString Summary = FString::Printf(TEXT("MoveCombining: %ds of inputs at %dfps, %.0fms round trip, pool of %d. Strict: %.1f moves/s sent, %d combined, %d important resent, %d allocated, %d corrections, client %.3fms, server %.2fus per move, %.3fms per player second. Relaxed: %.1f moves/s sent, %d combined, %d important resent, %d allocated, %d corrections, client %.3fms, server %.2fus per move, %.3fms per player second"),
+		NumSeconds, FramesPerSecond, RoundTripSeconds * 1000.0f, Strict.PoolSize,
+		MovesPerSecond(Strict), Strict.MovesCombined, Strict.ImportantMoves, Strict.MovesAllocated, Strict.Corrections, Strict.ClientSeconds * 1000.0, ServerMicrosecondsPerMove(Strict), ServerMillisecondsPerSecond(Strict),
+		MovesPerSecond(Relaxed), Relaxed.MovesCombined, Relaxed.ImportantMoves, Relaxed.MovesAllocated, Relaxed.Corrections, Relaxed.ClientSeconds * 1000.0, ServerMicrosecondsPerMove(Relaxed), ServerMillisecondsPerSecond(Relaxed));
+
+	UE_LOG(LogICharacterMovement, Log, TEXT("UICharacterMovementComponent::BenchmarkMoveCombining: %s"), *Summary);
+
+	return Summary;
+}
+
+FString UICharacterMovementComponent::BenchmarkMoveSerialization(int32 NumSeconds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UICharacterMovementComponent::BenchmarkMoveSerialization"))
+
+	NumSeconds = FMath::Clamp(NumSeconds, 1, 3600);
+
+	using ENetworkMoveType = FCharacterNetworkMoveData::ENetworkMoveType;
+
+	static const int32 PacketsPerSecond = 60;
+	static const float RotationRate = 180.0f;
+
+	// Every packet carries a new move, about half of them a pending move and a few an old important move.
+	// The body turns towards the aim at its rotation rate, except while idling, and pitches with the aim while swimming.
+	TArray<FPOTCharacterNetworkMoveData> Moves;
+	TArray<ENetworkMoveType> MoveTypes;
+
+	FRandomStream Random(2525);
+	FRotator ControlRotation = FRotator::ZeroRotator;
+	FRotator Rotation = FRotator::ZeroRotator;
+	FVector LaunchVelocity = FVector::ZeroVector;
+	bool bIdle = false;
+	bool bSwimming = false;
+	bool bWantsSituationalAuthority = false;
+
+	const int32 NumPackets = NumSeconds * PacketsPerSecond;
+	for (int32 Packet = 0; Packet < NumPackets; Packet++)
+	{
+		if (Packet % (5 * PacketsPerSecond) == 0)
+		{
+			const float Activity = Random.FRand();
+			bIdle = Activity < 0.2f;
+			bSwimming = Activity > 0.9f;
+		}
+
+		const float LookAround = Random.FRand() < 0.01f ? Random.FRandRange(-90.0f, 90.0f) : 0.0f;
+		ControlRotation.Yaw = FRotator::NormalizeAxis(ControlRotation.Yaw + Random.FRandRange(-3.0f, 3.0f) + LookAround);
+		ControlRotation.Pitch = FMath::Clamp<FRotator::FReal>(ControlRotation.Pitch + Random.FRandRange(-1.0f, 1.0f), -60.0f, 60.0f);
+
+		if (!bIdle)
+		{
+			const FRotator::FReal MaxTurn = RotationRate / PacketsPerSecond;
+			Rotation.Yaw = FRotator::NormalizeAxis(Rotation.Yaw + FMath::Clamp(FMath::FindDeltaAngleDegrees(Rotation.Yaw, ControlRotation.Yaw), -MaxTurn, MaxTurn));
+		}
+		Rotation.Pitch = bSwimming ? ControlRotation.Pitch : 0.0f;
+
+		if (Random.FRand() < 0.003f)
+		{
+			LaunchVelocity = FVector(Random.FRandRange(-1500.0f, 1500.0f), Random.FRandRange(-1500.0f, 1500.0f), Random.FRandRange(300.0f, 1200.0f));
+		}
+		else
+		{
+			LaunchVelocity = LaunchVelocity.Size() < 10.0f ? FVector::ZeroVector : LaunchVelocity * 0.95f;
+		}
+
+		if (Random.FRand() < 0.01f)
+		{
+			bWantsSituationalAuthority = !bWantsSituationalAuthority;
+		}
+
+		auto AddMove = [&](ENetworkMoveType MoveType)
+		{
+			FPOTCharacterNetworkMoveData& Move = Moves.AddDefaulted_GetRef();
+			Move.ControlRotation = ControlRotation;
+			Move.Rotation = Rotation;
+			Move.LaunchVelocity = LaunchVelocity;
+			Move.bWantsSituationalAuthority = bWantsSituationalAuthority;
+			Move.bRotateToDirection = !bIdle && !FMath::IsNearlyEqual(Rotation.Yaw, ControlRotation.Yaw);
+			MoveTypes.Add(MoveType);
+		};
+
+		AddMove(ENetworkMoveType::NewMove);
+		if (Random.FRand() < 0.5f)
+		{
+			AddMove(ENetworkMoveType::PendingMove);
+		}
+		if (Random.FRand() < 0.05f)
+		{
+			AddMove(ENetworkMoveType::OldMove);
+		}
+	}
+
+	FBitWriter LegacyWriter(0, true);
+	FBitWriter Writer(0, true);
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 MoveIndex = 0; MoveIndex < Moves.Num(); MoveIndex++)
+	{
+		FPOTCharacterNetworkMoveData Move = Moves[MoveIndex];
+
+		// The previous format sent everything with every move, the launch velocity as the three doubles FVector::NetSerialize writes
+		bool bLocalSuccess = true;
+		Move.Rotation.NetSerialize(LegacyWriter, nullptr, bLocalSuccess);
+		LegacyWriter << Move.LaunchVelocity.X << Move.LaunchVelocity.Y << Move.LaunchVelocity.Z;
+		LegacyWriter.SerializeBits(&Move.bRotateToDirection, 1);
+		LegacyWriter.SerializeBits(&Move.bWantsSituationalAuthority, 1);
+
+		Move.SerializeMoveFields(Writer, MoveTypes[MoveIndex]);
+	}
+	const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+	// Decode against the control rotation the server gets from the engine's fields and compare with what was sent
+	FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+	int32 NumNewMoves = 0;
+	int32 RotationMismatches = 0;
+	int32 FlagMismatches = 0;
+	float MaxLaunchVelocityError = 0.0f;
+	for (int32 MoveIndex = 0; MoveIndex < Moves.Num() && !Reader.IsError(); MoveIndex++)
+	{
+		const FPOTCharacterNetworkMoveData& Sent = Moves[MoveIndex];
+
+		FPOTCharacterNetworkMoveData Received;
+		Received.ControlRotation.Yaw = FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Sent.ControlRotation.Yaw));
+		Received.SerializeMoveFields(Reader, MoveTypes[MoveIndex]);
+
+		FlagMismatches += Received.bRotateToDirection != Sent.bRotateToDirection ? 1 : 0;
+
+		if (MoveTypes[MoveIndex] != ENetworkMoveType::NewMove)
+		{
+			continue;
+		}
+
+		NumNewMoves++;
+		FlagMismatches += Received.bWantsSituationalAuthority != Sent.bWantsSituationalAuthority ? 1 : 0;
+
+		// Same precision as the compressed shorts the previous format used
+		if (FRotator::CompressAxisToShort(Received.Rotation.Yaw) != FRotator::CompressAxisToShort(Sent.Rotation.Yaw)
+			|| FRotator::CompressAxisToShort(Received.Rotation.Pitch) != FRotator::CompressAxisToShort(Sent.Rotation.Pitch)
+			|| FRotator::CompressAxisToShort(Received.Rotation.Roll) != FRotator::CompressAxisToShort(Sent.Rotation.Roll))
+		{
+			RotationMismatches++;
+		}
+
+		MaxLaunchVelocityError = FMath::Max(MaxLaunchVelocityError, static_cast<float>(FVector::Distance(Received.LaunchVelocity, Sent.LaunchVelocity)));
+	}
+
+	const double LegacyBitsPerPacket = static_cast<double>(LegacyWriter.GetNumBits()) / NumPackets;
+	const double BitsPerPacket = static_cast<double>(Writer.GetNumBits()) / NumPackets;
+
+	const FString Summary = FString::Printf(TEXT("MoveSerialization: %d packets, %d moves (%d new). Move fields %.1f bits per packet before, %.1f after (%.0f%% less), %.2f vs %.2f kbit/s upstream per client at %d packets/s. Encoded in %.3fms. Decode errors: %s, rotation mismatches %d, flag mismatches %d, max launch velocity error %.3f"),
+		NumPackets, Moves.Num(), NumNewMoves, LegacyBitsPerPacket, BitsPerPacket, 100.0 * (1.0 - BitsPerPacket / FMath::Max(LegacyBitsPerPacket, 1.0)),
+		LegacyBitsPerPacket * PacketsPerSecond / 1000.0, BitsPerPacket * PacketsPerSecond / 1000.0, PacketsPerSecond, Seconds * 1000.0,
+		Reader.IsError() ? TEXT("yes") : TEXT("no"), RotationMismatches, FlagMismatches, MaxLaunchVelocityError);
+
+	UE_LOG(LogICharacterMovement, Log, TEXT("UICharacterMovementComponent::BenchmarkMoveSerialization: %s"), *Summary);
+
+	return Summary;
 }
 
 void UICharacterMovementComponent::CalculateSweepData(class UPrimitiveComponent* ComponentToSimulate, const FVector& NewDelta, const FQuat& NewRotation, FVector& TraceStart, FVector& TraceEnd,
@@ -4792,8 +5498,9 @@ bool UICharacterMovementComponent::ProcessHits(bool bHadBlockingHits, TArray<FHi
 
 bool UICharacterMovementComponent::ShouldUseAsyncMultiCapsuleCollision(const UPrimitiveComponent* PComp) const
 {
-	//Swimming is just temporary until I figure out what's wrong with that
-	if ((!bForceAsyncMCC && AsyncCollisionMode == 0) || IsSwimming() || PComp == nullptr || PComp == UpdatedComponent)
+	//The trace worker leaves swimming out, the batched sweeps drop their cached hits on entering or leaving water instead
+	const bool bSkipSwimming = IsSwimming() && !ICharacterMovementCVars::CVarBatchMultiCapsuleSweeps->GetBool();
+	if ((!bForceAsyncMCC && AsyncCollisionMode == 0) || bSkipSwimming || PComp == nullptr || PComp == UpdatedComponent)
 	{
 		return false;
 	}
@@ -4805,7 +5512,7 @@ bool UICharacterMovementComponent::ShouldUseAsyncMultiCapsuleCollision(const UPr
 
 	if (AsyncCollisionMode == 1)
 	{
-		if (const FHitResult* HResult = CachedHits.Find(PComp))
+		if (const FHitResult* HResult = CachedHits.Find(FindCapsuleOrdinal(PComp)))
 		{
 			return HResult->bBlockingHit;
 		}
@@ -4814,6 +5521,13 @@ bool UICharacterMovementComponent::ShouldUseAsyncMultiCapsuleCollision(const UPr
 	return false;
 }
 
+static FPawnProximityGrid PawnProximityGrid;
+static TWeakObjectPtr<UWorld> PawnProximityGridWorld;
+static uint64 PawnProximityGridFrame = MAX_uint64;
+
+// Overlaps situational authority didn't have to run since startup, the stat only covers builds with stats
+static uint64 NumSituationalAuthorityOverlapsAvoided = 0;
+
 bool UICharacterMovementComponent::CanUseSituationalAuthority() const
 {
 	// Situational Authority is allowed if the player is moving fast enough, and there are other players nearby.
@@ -4849,18 +5563,75 @@ bool UICharacterMovementComponent::CanUseSituationalAuthority() const
 
 	bCachedSituationalAuth = false;
 
+	float SphereSize = OwnerBaseChar->GetCapsuleComponent()->GetScaledCapsuleRadius() * 15.0f;
+	FVector OverlapLocation = OwnerBaseChar->GetActorLocation() + (Velocity.GetSafeNormal() * SphereSize / 2);
+	//DrawDebugSphere(GetWorld(), OverlapLocation, SphereSize, 12, FColor::Yellow, false, 0.1f);
+
+	bool bDinosaurNearby = false;
+	if (ICharacterMovementCVars::CVarSituationalAuthorityGrid->GetBool())
+	{
+		INC_DWORD_STAT(STAT_SituationalAuthorityOverlapsAvoided);
+		NumSituationalAuthorityOverlapsAvoided++;
+		bDinosaurNearby = IsDinosaurInSphere(OverlapLocation, SphereSize);
+	}
+	else
+	{
+		bDinosaurNearby = IsDinosaurInSphereOverlap(OverlapLocation, SphereSize);
+	}
+
+	if (bDinosaurNearby)
+	{
+		bCachedSituationalAuth = true;
+		CachedSituationalAuthTime = WorldTime;
+		return true;
+	}
+
+	return false; // Only allow if there is nearby players. otherwise authority is not needed
+}
+
+const FPawnProximityGrid& UICharacterMovementComponent::GetPawnProximityGrid(UWorld* World)
+{
+	if (PawnProximityGridFrame != GFrameCounter || PawnProximityGridWorld.Get() != World)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UICharacterMovementComponent::RefreshPawnProximityGrid"))
+
+		PawnProximityGridFrame = GFrameCounter;
+		PawnProximityGridWorld = World;
+		PawnProximityGrid.SetCellSize(ICharacterMovementCVars::CVarPawnProximityGridCellSize->GetFloat());
+		PawnProximityGrid.Reset();
+
+		if (World)
+		{
+			for (TActorIterator<AIDinosaurCharacter> It(World); It; ++It)
+			{
+				PawnProximityGrid.AddActor(*It);
+			}
+		}
+	}
+
+	return PawnProximityGrid;
+}
+
+bool UICharacterMovementComponent::IsDinosaurInSphere(const FVector& Location, float Radius) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UICharacterMovementComponent::IsDinosaurInSphere"))
+
+	return GetPawnProximityGrid(GetWorld()).AnyOverlappingSphere(Location, Radius, CharacterOwner);
+}
+
+bool UICharacterMovementComponent::IsDinosaurInSphereOverlap(const FVector& Location, float Radius) const
+{
+	UWorld* World = GetWorld();
+	if (!World) return false;
+
 	FCollisionQueryParams QueryParams;
 	QueryParams.AddIgnoredActor(CharacterOwner);
 	FCollisionObjectQueryParams ObjectQueryParams;
 	ObjectQueryParams.AddObjectTypesToQuery(ECC_Pawn);
 	check(ObjectQueryParams.IsValid());
 
-	float SphereSize = OwnerBaseChar->GetCapsuleComponent()->GetScaledCapsuleRadius() * 15.0f;
-	FVector OverlapLocation = OwnerBaseChar->GetActorLocation() + (Velocity.GetSafeNormal() * SphereSize / 2);
-
 	TArray<FOverlapResult> OverlapResults;
-	World->OverlapMultiByObjectType(OverlapResults, OverlapLocation, FQuat::Identity, ObjectQueryParams, FCollisionShape::MakeSphere(SphereSize), QueryParams);
-	//DrawDebugSphere(GetWorld(), OverlapLocation, SphereSize, 12, FColor::Yellow, false, 0.1f);
+	World->OverlapMultiByObjectType(OverlapResults, Location, FQuat::Identity, ObjectQueryParams, FCollisionShape::MakeSphere(Radius), QueryParams);
 
 	for (const FOverlapResult& Result : OverlapResults)
 	{
@@ -4868,14 +5639,84 @@ bool UICharacterMovementComponent::CanUseSituationalAuthority() const
 		{
 			if (Cast<AIDinosaurCharacter>(Result.GetActor()) && Result.GetActor() != CharacterOwner)
 			{
-				bCachedSituationalAuth = true;
-				CachedSituationalAuthTime = WorldTime;
 				return true;
 			}
 		}
 	}
 
-	return false; // Only allow if there is nearby players. otherwise authority is not needed
+	return false;
+}
+
+FString UICharacterMovementComponent::BenchmarkSituationalAuthority(UWorld* World, int32 Iterations)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UICharacterMovementComponent::BenchmarkSituationalAuthority"))
+
+	Iterations = FMath::Max(Iterations, 1);
+
+	struct FAuthorityQuery
+	{
+		const UICharacterMovementComponent* Movement = nullptr;
+		FVector Location = FVector::ZeroVector;
+		float Radius = 0.0f;
+	};
+
+	// Same spheres CanUseSituationalAuthority would test for each dinosaur moving along a random heading
+	TArray<FAuthorityQuery> Queries;
+	if (World)
+	{
+		for (TActorIterator<AIDinosaurCharacter> It(World); It; ++It)
+		{
+			const UICharacterMovementComponent* Movement = Cast<UICharacterMovementComponent>(It->GetCharacterMovement());
+			if (!Movement || !It->GetCapsuleComponent())
+			{
+				continue;
+			}
+
+			const float SphereSize = It->GetCapsuleComponent()->GetScaledCapsuleRadius() * 15.0f;
+			for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+			{
+				FAuthorityQuery& Query = Queries.AddDefaulted_GetRef();
+				Query.Movement = Movement;
+				Query.Location = It->GetActorLocation() + (FMath::VRand() * SphereSize / 2);
+				Query.Radius = SphereSize;
+			}
+		}
+	}
+
+	int32 NumOverlapNearby = 0;
+	const double OverlapStart = FPlatformTime::Seconds();
+	for (const FAuthorityQuery& Query : Queries)
+	{
+		NumOverlapNearby += Query.Movement->IsDinosaurInSphereOverlap(Query.Location, Query.Radius) ? 1 : 0;
+	}
+	const double OverlapSeconds = FPlatformTime::Seconds() - OverlapStart;
+
+	// Force a rebuild so its cost is included in the grid timing.
+	PawnProximityGridFrame = MAX_uint64;
+
+	int32 NumGridNearby = 0;
+	const double GridStart = FPlatformTime::Seconds();
+	for (const FAuthorityQuery& Query : Queries)
+	{
+		NumGridNearby += Query.Movement->IsDinosaurInSphere(Query.Location, Query.Radius) ? 1 : 0;
+	}
+	const double GridSeconds = FPlatformTime::Seconds() - GridStart;
+
+	int32 Mismatches = 0;
+	for (const FAuthorityQuery& Query : Queries)
+	{
+		if (Query.Movement->IsDinosaurInSphereOverlap(Query.Location, Query.Radius) != Query.Movement->IsDinosaurInSphere(Query.Location, Query.Radius))
+		{
+			Mismatches++;
+		}
+	}
+
+	const FString Summary = FString::Printf(TEXT("SituationalAuthority: %d queries, %d grid shapes. Overlap: %.3fms (%d nearby) Grid: %.3fms (%d nearby) Mismatches: %d Overlaps avoided since startup: %llu"),
+		Queries.Num(), GetPawnProximityGrid(World).Num(), OverlapSeconds * 1000.0, NumOverlapNearby, GridSeconds * 1000.0, NumGridNearby, Mismatches, NumSituationalAuthorityOverlapsAvoided);
+
+	UE_LOG(LogICharacterMovement, Log, TEXT("UICharacterMovementComponent::BenchmarkSituationalAuthority: %s"), *Summary);
+
+	return Summary;
 }
 
 bool UICharacterMovementComponent::CanUseTolerantAuthority() const
@@ -4914,17 +5755,107 @@ void FPOTCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Ch
 	bRotateToDirection = IClientMove.bSavedPreciseRotateToDirection;
 }
 
+namespace ICharacterMoveSerialization
+{
+	// Deltas up to this many bits after zigzagging (about 11 degrees) are sent with their bit count, bigger ones as the whole short
+	static const uint32 MaxSmallDeltaBits = 12;
+
+	// Compressed short of the axis as a delta to the same axis of a rotation the reader already has
+	static void SerializeAxisDelta(FArchive& Ar, FRotator::FReal& Axis, FRotator::FReal ReferenceAxis)
+	{
+		const uint16 ReferenceShort = FRotator::CompressAxisToShort(ReferenceAxis);
+		uint16 AxisShort = Ar.IsSaving() ? FRotator::CompressAxisToShort(Axis) : ReferenceShort;
+
+		// Zigzag the wrapped delta so small turns either way need few bits
+		const int16 Delta = static_cast<int16>(AxisShort - ReferenceShort);
+		uint32 ZigZag = Delta >= 0 ? static_cast<uint32>(Delta) << 1 : (static_cast<uint32>(-(Delta + 1)) << 1) | 1;
+
+		bool bMatchesReference = ZigZag == 0;
+		Ar.SerializeBits(&bMatchesReference, 1);
+		if (!bMatchesReference)
+		{
+			bool bSmallDelta = ZigZag < (1u << MaxSmallDeltaBits);
+			Ar.SerializeBits(&bSmallDelta, 1);
+
+			if (bSmallDelta)
+			{
+				// The top bit is always set, only the ones below it are sent
+				uint32 TopBit = Ar.IsSaving() ? FMath::FloorLog2(ZigZag) : 0;
+				Ar.SerializeInt(TopBit, MaxSmallDeltaBits);
+
+				uint32 LowBits = Ar.IsSaving() ? ZigZag - (1u << TopBit) : 0;
+				if (TopBit > 0)
+				{
+					Ar.SerializeInt(LowBits, 1u << TopBit);
+				}
+				ZigZag = (1u << TopBit) + LowBits;
+
+				const int32 DecodedDelta = (ZigZag & 1) ? -static_cast<int32>(ZigZag >> 1) - 1 : static_cast<int32>(ZigZag >> 1);
+				AxisShort = static_cast<uint16>(ReferenceShort + DecodedDelta);
+			}
+			else
+			{
+				Ar << AxisShort;
+			}
+		}
+
+		if (Ar.IsLoading())
+		{
+			Axis = FRotator::DecompressAxisFromShort(AxisShort);
+		}
+	}
+
+	// Launch velocity is zero outside of launches, otherwise it is quantized to a tenth with as many bits as its size needs
+	static void SerializeLaunchVelocity(FArchive& Ar, FVector& LaunchVelocity)
+	{
+		bool bHasLaunchVelocity = !LaunchVelocity.IsZero();
+		Ar.SerializeBits(&bHasLaunchVelocity, 1);
+
+		if (bHasLaunchVelocity)
+		{
+			SerializePackedVector<10, 24>(LaunchVelocity, Ar);
+		}
+		else if (Ar.IsLoading())
+		{
+			LaunchVelocity = FVector::ZeroVector;
+		}
+	}
+}
+
+void FPOTCharacterNetworkMoveData::SerializeMoveFields(FArchive& Ar, ENetworkMoveType MoveType)
+{
+	Ar.SerializeBits(&bRotateToDirection, 1);
+
+	if (MoveType != ENetworkMoveType::NewMove)
+	{
+		if (Ar.IsLoading())
+		{
+			Rotation = FRotator::ZeroRotator;
+			LaunchVelocity = FVector::ZeroVector;
+			bWantsSituationalAuthority = false;
+		}
+
+		return;
+	}
+
+	Ar.SerializeBits(&bWantsSituationalAuthority, 1);
+
+	// Characters mostly face their aim, pitch and roll are mostly zero
+	ICharacterMoveSerialization::SerializeAxisDelta(Ar, Rotation.Yaw, ControlRotation.Yaw);
+	ICharacterMoveSerialization::SerializeAxisDelta(Ar, Rotation.Pitch, 0.0f);
+	ICharacterMoveSerialization::SerializeAxisDelta(Ar, Rotation.Roll, 0.0f);
+
+	ICharacterMoveSerialization::SerializeLaunchVelocity(Ar, LaunchVelocity);
+}
+
 bool FPOTCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType)
 {
 	if (!FCharacterNetworkMoveData::Serialize(CharacterMovement, Ar, PackageMap, MoveType))
 	{
 		return false;
 	}
-	bool bLocalSuccess = true;
-	Rotation.NetSerialize(Ar, PackageMap, bLocalSuccess);
-	LaunchVelocity.NetSerialize(Ar, PackageMap, bLocalSuccess);
-	Ar.SerializeBits(&bRotateToDirection, 1);
-	Ar.SerializeBits(&bWantsSituationalAuthority, 1);
+
+	SerializeMoveFields(Ar, MoveType);
 
 	AActor* const OwnerActor = CharacterMovement.GetOwner();
 	if (!ensureAlways(OwnerActor))
@@ -5522,7 +6453,7 @@ bool FSavedMove_ICharacter::IsImportantMove(const FSavedMovePtr& LastAckedMove)
 	if (bSavedWantsToStop != LastAckedIMove->bSavedWantsToStop) return true;
 	if (bSavedWantsToPreciseMove != LastAckedIMove->bSavedWantsToPreciseMove) return true;
 	if (bSavedWantsSituationalAuthority != LastAckedIMove->bSavedWantsSituationalAuthority) return true;
-	if (bSavedPreciseRotateToDirection != LastAckedIMove->bSavedPreciseRotateToDirection) return true;
+	if (bSavedPreciseRotateToDirection != LastAckedIMove->bSavedPreciseRotateToDirection && !IsAimWithinCombineTolerance(*LastAckedIMove)) return true;
 	if (SavedLaunchVelocity != LastAckedIMove->SavedLaunchVelocity)
 	{
 		if ((FMath::Abs(SavedLaunchVelocity.Size() - LastAckedIMove->SavedLaunchVelocity.Size()) > 50) || ((SavedLaunchVelocity.GetSafeNormal() | LastAckedIMove->SavedLaunchVelocity.GetSafeNormal()) < AccelDotThreshold))
@@ -5579,7 +6510,8 @@ bool FSavedMove_ICharacter::CanCombineWith(const FSavedMovePtr& NewMove, ACharac
 	if (bSavedWantsToStop != NewIMove->bSavedWantsToStop) return false;
 	if (bSavedWantsToPreciseMove != NewIMove->bSavedWantsToPreciseMove) return false;
 	if (bSavedWantsSituationalAuthority != NewIMove->bSavedWantsSituationalAuthority) return false;
-	if (bSavedPreciseRotateToDirection != NewIMove->bSavedPreciseRotateToDirection) return false;
+	const bool bRotateToDirectionDiffers = bSavedPreciseRotateToDirection != NewIMove->bSavedPreciseRotateToDirection;
+	if (bRotateToDirectionDiffers && !IsAimWithinCombineTolerance(*NewIMove)) return false;
 	if (SavedLaunchVelocity != NewIMove->SavedLaunchVelocity)
 	{
 		if ((FMath::Abs(SavedLaunchVelocity.Size() - NewIMove->SavedLaunchVelocity.Size()) > 50) || ((SavedLaunchVelocity.GetSafeNormal() | NewIMove->SavedLaunchVelocity.GetSafeNormal()) < AccelDotThreshold))
@@ -5592,9 +6524,36 @@ bool FSavedMove_ICharacter::CanCombineWith(const FSavedMovePtr& NewMove, ACharac
 	check(BaseCharacter);
 	bool bCanCombine = Super::CanCombineWith(NewMove, InPawn, MaxDelta);
 
+	if (bCanCombine && bRotateToDirectionDiffers)
+	{
+		INC_DWORD_STAT(STAT_SavedMovesCombinedRelaxed);
+	}
+
 	return bCanCombine;
 }
 
+bool FSavedMove_ICharacter::IsAimWithinCombineTolerance(const FSavedMove_ICharacter& Other) const
+{
+	if (!ICharacterMovementCVars::CVarRelaxedMoveCombining->GetBool())
+	{
+		return false;
+	}
+
+	const float Tolerance = ICharacterMovementCVars::CVarMoveCombineAimTolerance->GetFloat();
+	if (!SavedControlRotation.Equals(Other.SavedControlRotation, Tolerance))
+	{
+		return false;
+	}
+
+	// Rotate to direction turns towards the input, otherwise the character faces the aim. Same thing while the input points along the aim.
+	auto IsInputAlongAim = [Tolerance](const FSavedMove_ICharacter& Move)
+	{
+		return Move.Acceleration.IsNearlyZero() || FMath::Abs(FMath::FindDeltaAngleDegrees(Move.Acceleration.Rotation().Yaw, Move.SavedControlRotation.Yaw)) <= Tolerance;
+	};
+
+	return IsInputAlongAim(*this) && IsInputAlongAim(Other);
+}
+
 void FSavedMove_ICharacter::CombineWith(const FSavedMove_Character* OldMove, ACharacter* InCharacter, APlayerController* PC, const FVector& OldStartLocation)
 {
 	const FSavedMove_ICharacter* OldIMove = static_cast<const FSavedMove_ICharacter*>(OldMove);
@@ -5658,6 +6617,9 @@ uint8 FSavedMove_ICharacter::GetCompressedFlags() const
 
 FSavedMovePtr FNetworkPredictionData_Client_ICharacter::AllocateNewMove()
 {
+	NumMovesAllocated++;
+	INC_DWORD_STAT(STAT_SavedMovesAllocated);
+
 	return FSavedMovePtr(new FSavedMove_ICharacter());
 }
 
@@ -5687,8 +6649,7 @@ bool FICharacterMoveResponseDataContainer::Serialize(UCharacterMovementComponent
 
 		if (bHasLaunchVelocity)
 		{
-			bool bLocalSuccess = true;
-			ResponseLaunchVelocity.NetSerialize(Ar, PackageMap, bLocalSuccess);
+			SerializePackedVector<10, 24>(ResponseLaunchVelocity, Ar);
 		}
 	}
 	return !Ar.IsError();
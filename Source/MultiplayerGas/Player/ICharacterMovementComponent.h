@@ -8,6 +8,7 @@
 #include "ICharacterMovementComponent.generated.h"
 
 class AIDinosaurCharacter;
+struct FPawnProximityGrid;
 
 struct FICharacterMoveResponseDataContainer : FCharacterMoveResponseDataContainer
 {
@@ -31,6 +32,12 @@ public:
 
 	virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType) override;
 
+	/**
+	 * Our fields of the move, after the engine's. Rotation, launch velocity and situational authority are only used for error checking
+	 * so like the engine's Location they only go with the new move. Rotation is sent as a delta to the control rotation the engine already sent.
+	 */
+	void SerializeMoveFields(FArchive& Ar, ENetworkMoveType MoveType);
+
 	FRotator Rotation = FRotator::ZeroRotator;
 	FVector LaunchVelocity = FVector::ZeroVector;
 	bool bWantsSituationalAuthority = false;
@@ -38,6 +45,33 @@ public:
 };
 
 
+/**
+ * Result of the last sweep of each additional capsule, indexed by the capsule's ordinal in AdditionalCapsules.
+ * Sized once per capsule set so moves only overwrite slots, never allocate.
+ */
+struct PATHOFTITANS_API FCapsuleHitCache
+{
+public:
+	// Resizes for a new capsule set, every slot starts out invalid
+	void Reset(int32 NumCapsules);
+
+	// Drops every cached hit but keeps the storage
+	void Invalidate();
+
+	// nullptr if nothing was cached for the capsule since the last invalidation
+	const FHitResult* Find(int32 Ordinal) const;
+
+	// Slot to write the capsule's new result to, marked valid
+	FHitResult& Store(int32 Ordinal);
+
+	int32 Num() const { return Hits.Num(); }
+	SIZE_T GetAllocatedSize() const { return Hits.GetAllocatedSize() + Valid.GetAllocatedSize(); }
+
+private:
+	TArray<FHitResult> Hits;
+	TBitArray<> Valid;
+};
+
 struct FPOTCharacterNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
 {
 public:
@@ -132,6 +166,18 @@ public:
 	bool CanUseSituationalAuthority() const;
 	bool CanUseTolerantAuthority() const;
 
+	// Whether a dinosaur other than our owner touches the sphere, answered from the shared pawn proximity grid
+	bool IsDinosaurInSphere(const FVector& Location, float Radius) const;
+
+	// Reference implementation of IsDinosaurInSphere using a physics overlap, kept for BenchmarkSituationalAuthority
+	bool IsDinosaurInSphereOverlap(const FVector& Location, float Radius) const;
+
+	// Dinosaur collision shapes of the world, rebuilt on the first query of each frame
+	static const FPawnProximityGrid& GetPawnProximityGrid(UWorld* World);
+
+	// Compares grid and overlap answers for spheres around every dinosaur of the world, Iterations random headings each
+	static FString BenchmarkSituationalAuthority(UWorld* World, int32 Iterations);
+
 	virtual float ImmersionDepth() const override;
 
 protected:
@@ -655,8 +701,28 @@ protected:
 	UPROPERTY(AdvancedDisplay, EditDefaultsOnly)
 	bool bForceAsyncMCC;
 
-	UPROPERTY(Transient)
-	TMap<const class UPrimitiveComponent*, FHitResult> CachedHits;
+	FCapsuleHitCache CachedHits;
+
+	// Mesh the cached hits were swept with, capsules attached to its bones move when it is swapped
+	TWeakObjectPtr<const USkeletalMesh> CachedHitsMesh;
+
+	// Ordinal of the capsule in AdditionalCapsules and CachedHits, INDEX_NONE if it isn't one of ours
+	int32 FindCapsuleOrdinal(const UPrimitiveComponent* PComp) const;
+
+public:
+	// Forget the cached capsule sweep results, for anything that changes the capsules' size or shape (growth, mesh swaps)
+	void InvalidateCachedHits();
+
+	// Replays a recorded input trace on an off-map client stand-in with the strict and relaxed combining policies,
+	// timing a second stand-in's ServerMove_PerformMovement on every move it sends
+	static FString BenchmarkMoveCombining(ACharacter* Character, int32 NumSeconds);
+
+	// Counts the bits our move fields take in the previous and the current format over a recorded move stream, and checks they decode the same
+	static FString BenchmarkMoveSerialization(int32 NumSeconds);
+
+	// Spawns 300 off-map characters of TemplateCharacter's class and sweeps their capsules through SimulatedMinutes of moves
+	// with growth invalidations and capsule set changes, reporting the hit caches' memory at the start, peak and end
+	static FString BenchmarkCachedHits(ACharacter* TemplateCharacter, int32 SimulatedMinutes);
 
 private:
 	int32 IncrementalUpdateIndex;
@@ -679,12 +745,17 @@ protected:
 	bool ShouldIgnoreHitResult(const UWorld* InWorld, const UPrimitiveComponent* TestComponent, FHitResult const& TestHit, FVector const& MovementDirDenormalized, const AActor* MovingActor, EMoveComponentFlags MoveFlags);
 
 	void ProcessCompletedAsyncSweepMulti(const FQueuedMultiCapsuleTrace& CompletedTrace);
+	void ProcessCompletedBatchedSweep(const struct FBatchedCapsuleSweep& CompletedSweep, const UPrimitiveComponent* Capsule, int32 CapsuleIndex, const TArray<FHitResult>& Hits);
+
+	// Keeps the blocking hit of a finished async sweep for the capsule's next moves
+	void CacheAsyncSweepHits(int32 CapsuleOrdinal, const UPrimitiveComponent* PrimComp, const TArray<FHitResult>& Hits, const FVector& Start, const FVector& End, const FVector& NewDelta, EMoveComponentFlags MoveFlags);
 
 	bool IsSurfacing(FHitResult HitResult, FVector TraceStart) const;
 
 	void CalculateSweepData(class UPrimitiveComponent* ComponentToSimulate, const FVector& NewDelta, const FQuat& NewRotation, FVector& TraceStart, FVector& TraceEnd, FQuat& NewComponentQuat, FComponentQueryParams& QueryParams, FCollisionResponseParams& ResponseParams);
 
 	friend class FMultiCapsuleTraceWorker;
+	friend class FMultiCapsuleSweepBatcher;
 
 	UPROPERTY(Transient, BlueprintReadOnly)
 	TArray<UCapsuleComponent*> AdditionalCapsules;
@@ -771,6 +842,12 @@ public:
 	/** @returns a byte containing encoded special movement information (jumping, crouching, etc.)	 */
 	virtual uint8 GetCompressedFlags() const override;
 
+	/**
+	 * @Return true if relaxed move combining is on and both the aim and the input direction relative to the aim of the two moves
+	 * are within pot.MoveCombineAimTolerance. Rotating to the input direction then turns the same way as facing the aim does.
+	 */
+	bool IsAimWithinCombineTolerance(const FSavedMove_ICharacter& Other) const;
+
 	// Bit masks used by GetCompressedFlags() to encode movement information.
 	enum ICharacterCompressedFlags
 	{
@@ -795,6 +872,9 @@ public:
 
 	/** Allocate a new saved move. Subclasses should override this if they want to use a custom move class. */
 	virtual FSavedMovePtr AllocateNewMove() override;
+
+	// Saved moves allocated over the lifetime of this data
+	int32 NumMovesAllocated = 0;
 };
 
 class PATHOFTITANS_API FNetworkPredictionData_Server_ICharacter : public FNetworkPredictionData_Server_Character
@@ -0,0 +1,165 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#include "Components/MultiCapsuleSweepBatcher.h"
+#include "Components/ICharacterMovementComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "Misc/CoreDelegates.h"
+#include "Stats/IStats.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMultiCapsuleSweeps, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("MultiCapsuleSweeps"), STATGROUP_MultiCapsuleSweeps, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sweeps Queued Per Frame"), STAT_MultiCapsuleSweepsQueued, STATGROUP_MultiCapsuleSweeps);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sweeps Completed Per Frame"), STAT_MultiCapsuleSweepsCompleted, STATGROUP_MultiCapsuleSweeps);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sweeps Superseded Per Frame"), STAT_MultiCapsuleSweepsSuperseded, STATGROUP_MultiCapsuleSweeps);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Repeat Sweeps Skipped Per Frame"), STAT_MultiCapsuleSweepsSkipped, STATGROUP_MultiCapsuleSweeps);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sweeps In Flight"), STAT_MultiCapsuleSweepsInFlight, STATGROUP_MultiCapsuleSweeps);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Queue To Result (ms)"), STAT_MultiCapsuleSweepLatencyMs, STATGROUP_MultiCapsuleSweeps);
+
+// Sweeps of a world that was torn down never complete, forget them after this many frames
+static const uint64 MaxSweepAgeFrames = 30;
+
+FMultiCapsuleSweepBatcher& FMultiCapsuleSweepBatcher::Get()
+{
+	static FMultiCapsuleSweepBatcher Instance;
+	return Instance;
+}
+
+FMultiCapsuleSweepBatcher::FMultiCapsuleSweepBatcher()
+{
+	SweepDelegate.BindRaw(this, &FMultiCapsuleSweepBatcher::OnSweepDone);
+
+	// Publish every frame, including frames where no character moved, the batcher lives as long as the process
+	FCoreDelegates::OnEndFrame.AddRaw(this, &FMultiCapsuleSweepBatcher::AdvanceFrame);
+}
+
+void FMultiCapsuleSweepBatcher::QueueSweep(UICharacterMovementComponent* Movement, UCapsuleComponent* Capsule, int32 CapsuleIndex, const FVector& Start, const FVector& End, const FVector& Delta,
+	const FQuat& Rotation, const FComponentQueryParams& QueryParams, const FCollisionResponseParams& ResponseParams, EMoveComponentFlags MoveFlags)
+{
+	check(IsInGameThread());
+
+	UWorld* World = Movement ? Movement->GetWorld() : nullptr;
+	if (!World || !Capsule)
+	{
+		return;
+	}
+
+	AdvanceFrame();
+
+	FCapsuleSweepKey Key;
+	Key.Movement = Movement;
+	Key.CapsuleIndex = CapsuleIndex;
+
+	// The world's async batch only runs once the frame's ticking is done, a second sweep for the same capsule this frame
+	// would be traced alongside the first and then thrown away. The next frame's move queues a fresh one.
+	if (const uint32* const NewestSweepId = NewestSweeps.Find(Key))
+	{
+		const FBatchedCapsuleSweep* const InFlightSweep = PendingSweeps.Find(*NewestSweepId);
+		if (InFlightSweep && InFlightSweep->QueuedFrame == GFrameCounter)
+		{
+			FrameSweepsSkipped++;
+			return;
+		}
+	}
+
+	const uint32 SweepId = NextSweepId++;
+
+	FBatchedCapsuleSweep& Sweep = PendingSweeps.Add(SweepId);
+	Sweep.Key = Key;
+	Sweep.Movement = Movement;
+	Sweep.Capsule = Capsule;
+	Sweep.Start = Start;
+	Sweep.End = End;
+	Sweep.Delta = Delta;
+	Sweep.Rotation = Rotation;
+	Sweep.QueryParams = QueryParams;
+	Sweep.ResponseParams = ResponseParams;
+	Sweep.MoveFlags = MoveFlags;
+	Sweep.QueuedTime = FPlatformTime::Seconds();
+	Sweep.QueuedFrame = GFrameCounter;
+
+	NewestSweeps.Add(Sweep.Key, SweepId);
+
+	// Same shape and channel the synchronous path sweeps with
+	World->AsyncSweepByChannel(EAsyncTraceType::Multi, Start, End, Rotation, Capsule->GetCollisionObjectType(), Capsule->GetCollisionShape(0.01f),
+		QueryParams, ResponseParams, &SweepDelegate, SweepId);
+
+	FrameSweepsQueued++;
+}
+
+void FMultiCapsuleSweepBatcher::OnSweepDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FMultiCapsuleSweepBatcher::OnSweepDone"))
+
+	AdvanceFrame();
+
+	FBatchedCapsuleSweep Sweep;
+	if (!PendingSweeps.RemoveAndCopyValue(TraceDatum.UserData, Sweep))
+	{
+		return;
+	}
+
+	const uint32* const NewestSweepId = NewestSweeps.Find(Sweep.Key);
+	if (!NewestSweepId || *NewestSweepId != TraceDatum.UserData)
+	{
+		FrameSweepsSuperseded++;
+		return;
+	}
+
+	NewestSweeps.Remove(Sweep.Key);
+
+	FrameSweepsCompleted++;
+	FrameLatencySeconds += FPlatformTime::Seconds() - Sweep.QueuedTime;
+
+	UICharacterMovementComponent* const Movement = Sweep.Movement.Get();
+	UCapsuleComponent* const Capsule = Sweep.Capsule.Get();
+	if (Movement && Capsule)
+	{
+		Movement->ProcessCompletedBatchedSweep(Sweep, Capsule, Sweep.Key.CapsuleIndex, TraceDatum.OutHits);
+	}
+}
+
+void FMultiCapsuleSweepBatcher::AdvanceFrame()
+{
+	if (StatsFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	const float AverageLatencyMs = FrameSweepsCompleted > 0 ? static_cast<float>(FrameLatencySeconds * 1000.0 / FrameSweepsCompleted) : 0.0f;
+
+	SET_DWORD_STAT(STAT_MultiCapsuleSweepsQueued, FrameSweepsQueued);
+	SET_DWORD_STAT(STAT_MultiCapsuleSweepsCompleted, FrameSweepsCompleted);
+	SET_DWORD_STAT(STAT_MultiCapsuleSweepsSuperseded, FrameSweepsSuperseded);
+	SET_DWORD_STAT(STAT_MultiCapsuleSweepsSkipped, FrameSweepsSkipped);
+	SET_DWORD_STAT(STAT_MultiCapsuleSweepsInFlight, PendingSweeps.Num());
+	SET_FLOAT_STAT(STAT_MultiCapsuleSweepLatencyMs, AverageLatencyMs);
+
+	if (FrameSweepsQueued > 0 || FrameSweepsCompleted > 0)
+	{
+		UE_LOG(LogMultiCapsuleSweeps, Verbose, TEXT("Frame %llu: %d sweeps queued, %d completed, %d superseded, %d skipped, %d in flight, %.3fms average latency"),
+			StatsFrame, FrameSweepsQueued, FrameSweepsCompleted, FrameSweepsSuperseded, FrameSweepsSkipped, PendingSweeps.Num(), AverageLatencyMs);
+	}
+
+	StatsFrame = GFrameCounter;
+	FrameSweepsQueued = 0;
+	FrameSweepsCompleted = 0;
+	FrameSweepsSuperseded = 0;
+	FrameSweepsSkipped = 0;
+	FrameLatencySeconds = 0.0;
+
+	for (auto It = PendingSweeps.CreateIterator(); It; ++It)
+	{
+		if (GFrameCounter - It.Value().QueuedFrame > MaxSweepAgeFrames)
+		{
+			const uint32* const NewestSweepId = NewestSweeps.Find(It.Value().Key);
+			if (NewestSweepId && *NewestSweepId == It.Key())
+			{
+				NewestSweeps.Remove(It.Value().Key);
+			}
+
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,87 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WorldCollision.h"
+#include "Engine/EngineTypes.h"
+
+class UICharacterMovementComponent;
+class UCapsuleComponent;
+
+// Identifies the additional capsule of a character a batched sweep belongs to
+struct FCapsuleSweepKey
+{
+	TObjectKey<UICharacterMovementComponent> Movement;
+	int32 CapsuleIndex = INDEX_NONE;
+
+	bool operator==(const FCapsuleSweepKey& Other) const
+	{
+		return Movement == Other.Movement && CapsuleIndex == Other.CapsuleIndex;
+	}
+
+	friend uint32 GetTypeHash(const FCapsuleSweepKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Movement), GetTypeHash(Key.CapsuleIndex));
+	}
+};
+
+// An additional capsule sweep waiting on the world's async trace batch
+struct FBatchedCapsuleSweep
+{
+	FCapsuleSweepKey Key;
+	TWeakObjectPtr<UICharacterMovementComponent> Movement;
+	TWeakObjectPtr<UCapsuleComponent> Capsule;
+
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	FVector Delta = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FComponentQueryParams QueryParams;
+	FCollisionResponseParams ResponseParams;
+	EMoveComponentFlags MoveFlags = MOVECOMP_NoFlags;
+
+	double QueuedTime = 0.0;
+	uint64 QueuedFrame = 0;
+};
+
+/**
+ * Gathers the additional capsule sweeps of every character moved during a frame into the world's
+ * async trace batch, which runs them together once the frame's movement is done.
+ * Results come back next frame through UICharacterMovementComponent::ProcessCompletedBatchedSweep,
+ * only the newest sweep of each character and capsule is applied and at most one is traced per frame.
+ */
+class PATHOFTITANS_API FMultiCapsuleSweepBatcher
+{
+public:
+	static FMultiCapsuleSweepBatcher& Get();
+
+	void QueueSweep(UICharacterMovementComponent* Movement, UCapsuleComponent* Capsule, int32 CapsuleIndex, const FVector& Start, const FVector& End, const FVector& Delta,
+		const FQuat& Rotation, const FComponentQueryParams& QueryParams, const FCollisionResponseParams& ResponseParams, EMoveComponentFlags MoveFlags);
+
+	int32 GetNumPendingSweeps() const { return PendingSweeps.Num(); }
+
+private:
+	FMultiCapsuleSweepBatcher();
+
+	void OnSweepDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	// Publishes the counters of the last frame once a new one starts, also called at the end of every frame
+	void AdvanceFrame();
+
+	FTraceDelegate SweepDelegate;
+
+	TMap<uint32, FBatchedCapsuleSweep> PendingSweeps;
+
+	// Newest sweep queued for each character and capsule, older results still in flight are dropped
+	TMap<FCapsuleSweepKey, uint32> NewestSweeps;
+
+	uint32 NextSweepId = 0;
+
+	uint64 StatsFrame = 0;
+	int32 FrameSweepsQueued = 0;
+	int32 FrameSweepsCompleted = 0;
+	int32 FrameSweepsSuperseded = 0;
+	int32 FrameSweepsSkipped = 0;
+	double FrameLatencySeconds = 0.0;
+};
@@ -0,0 +1,154 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#include "Components/PawnProximityGrid.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/Actor.h"
+
+FPawnProximityGrid::FPawnProximityGrid(float InCellSize)
+{
+	SetCellSize(InCellSize);
+}
+
+void FPawnProximityGrid::SetCellSize(float InCellSize)
+{
+	const float NewCellSize = FMath::Max(InCellSize, 100.0f);
+	if (NewCellSize != CellSize)
+	{
+		CellSize = NewCellSize;
+		Reset();
+	}
+}
+
+void FPawnProximityGrid::Reset()
+{
+	// Keep the cell allocations around, pawns mostly stay in the same cells from one frame to the next.
+	for (TPair<FIntPoint, TArray<int32, TInlineAllocator<4>>>& Cell : Cells)
+	{
+		Cell.Value.Reset();
+	}
+
+	Shapes.Reset();
+}
+
+FIntPoint FPawnProximityGrid::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void FPawnProximityGrid::AddActor(const AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	Actor->ForEachComponent<UPrimitiveComponent>(false, [this, Actor](const UPrimitiveComponent* Primitive)
+	{
+		// Same filter an ECC_Pawn object type overlap applies
+		if (!Primitive->IsRegistered() || !Primitive->IsQueryCollisionEnabled() || Primitive->GetCollisionObjectType() != ECC_Pawn)
+		{
+			return;
+		}
+
+		if (const UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(Primitive))
+		{
+			const FVector Center = Capsule->GetComponentLocation();
+			const FVector HalfSegment = Capsule->GetUpVector() * Capsule->GetScaledCapsuleHalfHeight_WithoutHemisphere();
+			AddCapsule(Actor, Center - HalfSegment, Center + HalfSegment, Capsule->GetScaledCapsuleRadius());
+		}
+		else
+		{
+			AddBox(Actor, Primitive->Bounds.GetBox());
+		}
+	});
+}
+
+void FPawnProximityGrid::AddCapsule(const AActor* Owner, const FVector& SegmentStart, const FVector& SegmentEnd, float Radius)
+{
+	FShape Shape;
+	Shape.Owner = Owner;
+	Shape.SegmentStart = SegmentStart;
+	Shape.SegmentEnd = SegmentEnd;
+	Shape.Radius = Radius;
+
+	FBox Bounds(ForceInit);
+	Bounds += SegmentStart;
+	Bounds += SegmentEnd;
+
+	AddShape(Shape, Bounds.ExpandBy(Radius));
+}
+
+void FPawnProximityGrid::AddBox(const AActor* Owner, const FBox& Box)
+{
+	if (!Box.IsValid)
+	{
+		return;
+	}
+
+	FShape Shape;
+	Shape.Owner = Owner;
+	Shape.Box = Box;
+	Shape.bIsBox = true;
+
+	AddShape(Shape, Box);
+}
+
+void FPawnProximityGrid::AddShape(const FShape& Shape, const FBox& Bounds)
+{
+	const int32 ShapeIndex = Shapes.Add(Shape);
+
+	const FIntPoint Low = GetCell(Bounds.Min);
+	const FIntPoint High = GetCell(Bounds.Max);
+
+	for (int32 Y = Low.Y; Y <= High.Y; Y++)
+	{
+		for (int32 X = Low.X; X <= High.X; X++)
+		{
+			Cells.FindOrAdd(FIntPoint(X, Y)).Add(ShapeIndex);
+		}
+	}
+}
+
+bool FPawnProximityGrid::OverlapsSphere(const FShape& Shape, const FVector& Location, float Radius)
+{
+	if (Shape.bIsBox)
+	{
+		return Shape.Box.ComputeSquaredDistanceToPoint(Location) <= FMath::Square(Radius);
+	}
+
+	return FMath::PointDistToSegmentSquared(Location, Shape.SegmentStart, Shape.SegmentEnd) <= FMath::Square(Radius + Shape.Radius);
+}
+
+bool FPawnProximityGrid::AnyOverlappingSphere(const FVector& Location, float Radius, const AActor* IgnoredActor) const
+{
+	if (IsEmpty() || Radius < 0.0f)
+	{
+		return false;
+	}
+
+	const FIntPoint Low = GetCell(Location - FVector(Radius, Radius, 0.0f));
+	const FIntPoint High = GetCell(Location + FVector(Radius, Radius, 0.0f));
+
+	for (int32 Y = Low.Y; Y <= High.Y; Y++)
+	{
+		for (int32 X = Low.X; X <= High.X; X++)
+		{
+			const TArray<int32, TInlineAllocator<4>>* const CellShapes = Cells.Find(FIntPoint(X, Y));
+			if (!CellShapes)
+			{
+				continue;
+			}
+
+			for (const int32 ShapeIndex : *CellShapes)
+			{
+				const FShape& Shape = Shapes[ShapeIndex];
+				if (Shape.Owner != IgnoredActor && OverlapsSphere(Shape, Location, Radius))
+				{
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,59 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+/**
+ * Uniform 2D grid of the pawn collision shapes of a world, refilled once per frame.
+ * Answers "does a sphere touch any of these pawns" the same way an ECC_Pawn object overlap would,
+ * capsules are tested exactly and any other pawn primitive by its bounding box.
+ */
+struct PATHOFTITANS_API FPawnProximityGrid
+{
+public:
+	explicit FPawnProximityGrid(float InCellSize = 2000.0f);
+
+	void SetCellSize(float InCellSize);
+	float GetCellSize() const { return CellSize; }
+
+	void Reset();
+
+	// Adds every query enabled ECC_Pawn primitive of the actor
+	void AddActor(const AActor* Actor);
+	void AddCapsule(const AActor* Owner, const FVector& SegmentStart, const FVector& SegmentEnd, float Radius);
+	void AddBox(const AActor* Owner, const FBox& Box);
+
+	int32 Num() const { return Shapes.Num(); }
+	bool IsEmpty() const { return Shapes.Num() == 0; }
+
+	// True if a shape of an actor other than IgnoredActor touches the sphere
+	bool AnyOverlappingSphere(const FVector& Location, float Radius, const AActor* IgnoredActor) const;
+
+private:
+	struct FShape
+	{
+		const AActor* Owner = nullptr;
+
+		// Capsule segment, unused for boxes
+		FVector SegmentStart = FVector::ZeroVector;
+		FVector SegmentEnd = FVector::ZeroVector;
+		float Radius = 0.0f;
+
+		FBox Box = FBox(ForceInit);
+		bool bIsBox = false;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+	void AddShape(const FShape& Shape, const FBox& Bounds);
+	static bool OverlapsSphere(const FShape& Shape, const FVector& Location, float Radius);
+
+	float CellSize = 2000.0f;
+
+	TArray<FShape> Shapes;
+
+	// Indices into Shapes, a shape is listed in every cell its bounds touch
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<4>>> Cells;
+};
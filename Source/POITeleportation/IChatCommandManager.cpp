@@ -10,6 +10,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "Quests/IPointOfInterest.h"
 #include "Quests/IPOI.h"
+#include "POIRegistrySubsystem.h"
 #include "Components/SphereComponent.h"
 #include "Misc/DefaultValueHelper.h"
 #include "Online/IGameState.h"
@@ -17,6 +18,7 @@
 #include "Abilities/CoreAttributeSet.h"
 #include "Abilities/POTAbilitySystemGlobals.h"
 #include "Online/IGameSession.h"
+#include "Online/WebhookDispatcher.h"
 #include "GameMode/IGameMode.h"
 #include "IWorldSettings.h"
 #include "UI/IChatWindow.h"
@@ -44,6 +46,8 @@
 #include "Abilities/POTGameplayAbility.h"
 #include "Abilities/POTGameplayEffect.h"
 #include "Abilities/POTAbilityTypes.h"
+#include "Abilities/POTAttributeSetInitter.h"
+#include "Components/ICharacterMovementComponent.h"
 #include "MapFog.h"
 #include "MapRevealerComponent.h"
 
@@ -329,6 +333,10 @@ void AIChatCommandManager::InitChatCommandManager()
 		.BindServer(this, &AIChatCommandManager::ServerPerfTest)
 		.AddFlags(COMMAND_HIDDEN);
 
+	RegisterChatCommand(TEXT("ServerBenchmark"), FText())
+		.BindServer(this, &AIChatCommandManager::ServerBenchmark)
+		.AddFlags(COMMAND_HIDDEN);
+
 	// Serverside Admin Commands
 	RegisterChatCommand(TEXT("ServerAutoRecord"), FText::FromStringTable(TEXT("ST_ChatCommands"), TEXT("CmdServerAutoRecordDescription")))
 		.BindServer(this, &AIChatCommandManager::ServerAutoRecord)
@@ -1201,43 +1209,21 @@ FChatCommandResponse AIChatCommandManager::ClearBodiesCommand(TArray<FString> Pa
 
 FChatCommandResponse AIChatCommandManager::ListPOICommand(TArray<FString> Params)
 {
-	TArray<AActor*> Pois;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AIPointOfInterest::StaticClass(), Pois);
-	TArray<AActor*> Pois2;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AIPOI::StaticClass(), Pois2);
+	UPOIRegistrySubsystem* const PoiRegistry = UPOIRegistrySubsystem::Get(this);
+	if (!PoiRegistry)
+	{
+		return GetResponseCmdNullObject(TEXT("PoiRegistry"));
+	}
 
-	TSet<FString> SentPOIs;
+	TArray<FString> PoiNames;
+	PoiRegistry->GetPoiNames(PoiNames);
 
 	FString Response = TEXT("");
 
-	for (int32 i = 0; i < Pois.Num(); i++)
-	{
-		AIPointOfInterest* IPointOfInterest = Cast<AIPointOfInterest>(Pois[i]);
-		if (IPointOfInterest != nullptr)
-		{
-			FString POIText = IPointOfInterest->GetLocationTag().ToString();
-			if (!SentPOIs.Contains(POIText))
-			{
-				SentPOIs.Add(POIText);
-				Response.Append(POIText);
-				Response.Append(TEXT(", "));
-			}
-		}
-	}
-
-	for (int32 i = 0; i < Pois2.Num(); i++)
+	for (const FString& POIText : PoiNames)
 	{
-		AIPOI* IPointOfInterest = Cast<AIPOI>(Pois2[i]);
-		if (IPointOfInterest != nullptr)
-		{
-			FString POIText = IPointOfInterest->GetLocationTag().ToString();
-			if (!SentPOIs.Contains(POIText))
-			{
-				SentPOIs.Add(POIText);
-				Response.Append(POIText);
-				Response.Append(TEXT(", "));
-			}
-		}
+		Response.Append(POIText);
+		Response.Append(TEXT(", "));
 	}
 	return AIChatCommand::MakePlainResponse(Response);
 }
@@ -3361,38 +3347,12 @@ AIWaystone* AIChatCommandManager::GetIWaystone(UWorld* World, const FString& Way
 
 AActor* AIChatCommandManager::GetPoi(UObject* WorldContextObject, const FString& PoiName)
 {
-	TArray<AActor*> Pois;
-	TArray<AActor*> Pois2;
-	UGameplayStatics::GetAllActorsOfClass(AIChatCommandManager::Get(WorldContextObject), AIPointOfInterest::StaticClass(), Pois);
-	UGameplayStatics::GetAllActorsOfClass(AIChatCommandManager::Get(WorldContextObject), AIPOI::StaticClass(), Pois2);
+	const UPOIRegistrySubsystem* const PoiRegistry = UPOIRegistrySubsystem::Get(WorldContextObject);
+	const FPoiRegistryGroup* const PossiblePois = PoiRegistry ? PoiRegistry->FindPois(PoiName) : nullptr;
 
-	TArray<AActor*> PossiblePois;
-
-	for (int32 i = 0; i < Pois.Num(); i++)
-	{
-		if (AIPointOfInterest* IPointOfInterest = Cast<AIPointOfInterest>(Pois[i]))
-		{
-			if (IPointOfInterest->GetLocationTag().ToString().ToLower() == PoiName.ToLower())
-			{
-				PossiblePois.Add(IPointOfInterest);
-			}
-		}
-	}
-
-	for (int32 i = 0; i < Pois2.Num(); i++)
+	if (PossiblePois && PossiblePois->Entries.Num() > 0)
 	{
-		if (AIPOI* IPointOfInterest = Cast<AIPOI>(Pois2[i]))
-		{
-			if (IPointOfInterest->GetLocationTag().ToString().ToLower() == PoiName.ToLower())
-			{
-				PossiblePois.Add(IPointOfInterest);
-			}
-		}
-	}
-
-	if (PossiblePois.Num() > 0)
-	{
-		return PossiblePois[FMath::RandRange(0, PossiblePois.Num() - 1)];
+		return PossiblePois->Entries[FMath::RandRange(0, PossiblePois->Entries.Num() - 1)].Actor.Get();
 	}
 
 	return nullptr;
@@ -3400,33 +3360,20 @@ AActor* AIChatCommandManager::GetPoi(UObject* WorldContextObject, const FString&
 
 bool AIChatCommandManager::GetLocationFromPoi(FString PoiName, FVector& Location, bool bAllowWater, float ActorHalfHeight)
 {
-	TArray<AActor*> Pois;
-	TArray<AActor*> Pois2;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AIPointOfInterest::StaticClass(), Pois);
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AIPOI::StaticClass(), Pois2);
-
-	UE_LOG(TitansLog, Log, TEXT("UIChatCommandManager::GetLocationFromPoi(): Found %i Points of interest"), Pois.Num() + Pois2.Num());
+	const UPOIRegistrySubsystem* const PoiRegistry = UPOIRegistrySubsystem::Get(this);
+	const FPoiRegistryGroup* const Pois = PoiRegistry ? PoiRegistry->FindPois(PoiName) : nullptr;
 
-	for (int32 i = 0; i < Pois.Num(); i++)
+	if (Pois)
 	{
-		if (AIPointOfInterest* IPointOfInterest = Cast<AIPointOfInterest>(Pois[i]))
+		for (const FPoiRegistryEntry& Entry : Pois->Entries)
 		{
-			if (IPointOfInterest->GetLocationTag().ToString().ToLower() == PoiName.ToLower())
+			if (AActor* Poi = Entry.Actor.Get())
 			{
-				return GetLocationFromPoi(IPointOfInterest, Location, bAllowWater, ActorHalfHeight);
-			}
-		}
-	}
-	for (int32 i = 0; i < Pois2.Num(); i++)
-	{
-		if (AIPOI* IPoi = Cast<AIPOI>(Pois2[i]))
-		{
-			if (IPoi->GetLocationTag().ToString().ToLower() == PoiName.ToLower())
-			{
-				return GetLocationFromPoi(IPoi, Location, bAllowWater, ActorHalfHeight);
+				return GetLocationFromPoi(Poi, Location, bAllowWater, ActorHalfHeight);
 			}
 		}
 	}
+
 	UE_LOG(TitansLog, Log, TEXT("UIChatCommandManager::GetLocationFromPoi(): Could not find safe location"));
 
 	return false;
@@ -3434,10 +3381,24 @@ bool AIChatCommandManager::GetLocationFromPoi(FString PoiName, FVector& Location
 
 bool AIChatCommandManager::GetLocationFromPoi(AActor* Poi, FVector& Location, bool bAllowWater, float ActorHalfHeight)
 {
+	// Landing points traced ahead of time, only trace here while the cache is still being built or a burst of teleports used it up
+	if (UPOIRegistrySubsystem* const PoiRegistry = UPOIRegistrySubsystem::Get(Poi))
+	{
+		if (PoiRegistry->DrawLandingPoint(Poi, bAllowWater, ActorHalfHeight, Location))
+		{
+			return true;
+		}
+
+		if (!bAllowWater && PoiRegistry->DrawLandingPoint(Poi, true, ActorHalfHeight, Location))
+		{
+			return true;
+		}
+	}
+
 	for (int32 Tries = 0; Tries < 25; Tries++)
 	{
 		FVector TempLocation = Location;
-		if (InternalGetLocationFromPoi(Poi, TempLocation, bAllowWater))
+		if (InternalGetLocationFromPoi(Poi, TempLocation, bAllowWater, ActorHalfHeight))
 		{
 			Location = TempLocation;
 			return true;
@@ -3464,40 +3425,10 @@ bool AIChatCommandManager::GetLocationFromPoi(AActor* Poi, FVector& Location, bo
 bool AIChatCommandManager::InternalGetLocationFromPoi(AActor* Poi, FVector& Location, bool bIsWaterAllowed, float ActorHalfHeight)
 {
 	FVector UnsafeLocation;
-	float PoiRadius = 1000;
-	bool bFoundRadius = false;
 
-	if (AIPointOfInterest* IPointOfInterest = Cast<AIPointOfInterest>(Poi))
-	{
-		UShapeComponent* ShapeComponent = IPointOfInterest->GetCollisionComponent();
-		if (ShapeComponent != nullptr)
-		{
-			USphereComponent* TriggerSphere = Cast<USphereComponent>(ShapeComponent);
-			if (TriggerSphere != nullptr)
-			{
-				PoiRadius = TriggerSphere->GetScaledSphereRadius();
-				bFoundRadius = true;
-			}
-		}
-	}
-
-	if (!bFoundRadius) // POI did not have a sphere component, we can try to get the bounds of a static mesh
-	{
-		if (AIPOI* IPointOfInterest = Cast<AIPOI>(Poi))
-		{
-			if (IPointOfInterest->GetMesh())
-			{
-				FVector Min, Max;
-				IPointOfInterest->GetMesh()->GetLocalBounds(Min, Max);
-				FVector Difference = Max - Min;
-				if (Difference.Size() > KINDA_SMALL_NUMBER)
-				{
-					PoiRadius = FMath::Max3(Difference.X, Difference.Y, Difference.Z) / 4.0f;
-					bFoundRadius = true;
-				}
-			}
-		}
-	}
+	const UPOIRegistrySubsystem* const PoiRegistry = UPOIRegistrySubsystem::Get(Poi);
+	const FPoiRegistryEntry* const PoiEntry = PoiRegistry ? PoiRegistry->FindEntry(Poi) : nullptr;
+	const float PoiRadius = PoiEntry ? PoiEntry->Radius : UPOIRegistrySubsystem::ComputePoiRadius(Poi);
 
 	// Get a random location on the X and Y plane of the POI location within its radius
 	UnsafeLocation = Poi->GetActorLocation() + ((FMath::VRand() * FVector{ 1, 1, 0 }) * PoiRadius);
@@ -6659,6 +6590,113 @@ FChatCommandResponse AIChatCommandManager::ServerPerfTest(AIPlayerController* Ca
 	return FChatCommandResponse();
 }
 
+FChatCommandResponse AIChatCommandManager::ServerBenchmark(AIPlayerController* CallingPlayer, TArray<FString> Params)
+{
+	if (CallingPlayer == nullptr || !CheckAdmin(CallingPlayer) || Params.Num() < 2)
+	{
+		return AIChatCommand::MakePlainResponse(TEXT("Usage: /ServerBenchmark <SpawnGrid|Moderation|Webhooks|Quests|DebuffTags|AttributeDefaults|BloodMask|SituationalAuthority|CachedHits|MoveCombining|MoveSerialization> [Iterations]"));
+	}
+
+	// Each benchmark picks its own default size
+	int32 Iterations = 0;
+	if (Params.IsValidIndex(2) && !FDefaultValueHelper::ParseInt(Params[2], Iterations))
+	{
+		return AIChatCommand::MakePlainResponse(TEXT("Error: Iterations must be a number"));
+	}
+
+	const FString& BenchmarkName = Params[1];
+
+	AIGameMode* const IGameMode = UIGameplayStatics::GetIGameMode(this);
+	if (!IGameMode)
+	{
+		return AIChatCommand::MakePlainResponse(TEXT("Error IGameMode nullptr"));
+	}
+
+	if (BenchmarkName.Equals(TEXT("SpawnGrid"), ESearchCase::IgnoreCase))
+	{
+		return AIChatCommand::MakePlainResponse(IGameMode->BenchmarkPlayerPositionGrid(Iterations > 0 ? Iterations : 100));
+	}
+
+	if (BenchmarkName.Equals(TEXT("Moderation"), ESearchCase::IgnoreCase))
+	{
+		AIGameSession* const IGameSession = Cast<AIGameSession>(IGameMode->GameSession);
+		if (!IGameSession)
+		{
+			return AIChatCommand::MakePlainResponse(TEXT("Error IGameSession nullptr"));
+		}
+
+		return AIChatCommand::MakePlainResponse(IGameSession->BenchmarkModerationJournal(Iterations > 0 ? Iterations : 100000));
+	}
+
+	if (BenchmarkName.Equals(TEXT("Webhooks"), ESearchCase::IgnoreCase))
+	{
+		UWebhookDispatcher* const Dispatcher = UWebhookDispatcher::Get();
+		if (!Dispatcher)
+		{
+			return AIChatCommand::MakePlainResponse(TEXT("Error UWebhookDispatcher nullptr"));
+		}
+
+		return AIChatCommand::MakePlainResponse(Dispatcher->BenchmarkThroughput(Iterations > 0 ? Iterations : 10000));
+	}
+
+	if (BenchmarkName.Equals(TEXT("Quests"), ESearchCase::IgnoreCase))
+	{
+		AIQuestManager* const QuestManager = AIWorldSettings::GetWorldSettings(this)->QuestManager;
+		if (!QuestManager)
+		{
+			return AIChatCommand::MakePlainResponse(TEXT("Error QuestManager nullptr"));
+		}
+
+		return AIChatCommand::MakePlainResponse(QuestManager->BenchmarkQuestDispatch(Iterations > 0 ? Iterations : 60, CallingPlayer->GetPawn<AIBaseCharacter>()));
+	}
+
+	if (BenchmarkName.Equals(TEXT("DebuffTags"), ESearchCase::IgnoreCase))
+	{
+		return AIChatCommand::MakePlainResponse(UCoreAttributeSet::BenchmarkDebuffTags(Iterations > 0 ? Iterations : 60));
+	}
+
+	if (BenchmarkName.Equals(TEXT("AttributeDefaults"), ESearchCase::IgnoreCase))
+	{
+		const FPOTAttributeSetInitter* const AttributeSetInitter = static_cast<const FPOTAttributeSetInitter*>(UAbilitySystemGlobals::Get().GetAttributeSetInitter());
+		if (!AttributeSetInitter)
+		{
+			return AIChatCommand::MakePlainResponse(TEXT("Error AttributeSetInitter nullptr"));
+		}
+
+		return AIChatCommand::MakePlainResponse(AttributeSetInitter->BenchmarkGradientDefaults(Iterations > 0 ? Iterations : 500));
+	}
+
+	if (BenchmarkName.Equals(TEXT("BloodMask"), ESearchCase::IgnoreCase))
+	{
+		return AIChatCommand::MakePlainResponse(AIBaseCharacter::BenchmarkBloodMask(Iterations > 0 ? Iterations : 20));
+	}
+
+	if (BenchmarkName.Equals(TEXT("SituationalAuthority"), ESearchCase::IgnoreCase))
+	{
+		return AIChatCommand::MakePlainResponse(UICharacterMovementComponent::BenchmarkSituationalAuthority(GetWorld(), Iterations > 0 ? Iterations : 16));
+	}
+
+	if (BenchmarkName.Equals(TEXT("CachedHits"), ESearchCase::IgnoreCase))
+	{
+		// Iterations are simulated minutes, moved by stand-ins of the calling player's character class
+		return AIChatCommand::MakePlainResponse(UICharacterMovementComponent::BenchmarkCachedHits(CallingPlayer->GetCharacter(), Iterations > 0 ? Iterations : 60));
+	}
+
+	if (BenchmarkName.Equals(TEXT("MoveCombining"), ESearchCase::IgnoreCase))
+	{
+		// Iterations are seconds of recorded input, replayed with the calling player's character and round trip
+		return AIChatCommand::MakePlainResponse(UICharacterMovementComponent::BenchmarkMoveCombining(CallingPlayer->GetCharacter(), Iterations > 0 ? Iterations : 300));
+	}
+
+	if (BenchmarkName.Equals(TEXT("MoveSerialization"), ESearchCase::IgnoreCase))
+	{
+		// Iterations are seconds of recorded moves
+		return AIChatCommand::MakePlainResponse(UICharacterMovementComponent::BenchmarkMoveSerialization(Iterations > 0 ? Iterations : 300));
+	}
+
+	return AIChatCommand::MakePlainResponse(FString::Printf(TEXT("Error: Unknown benchmark %s"), *BenchmarkName));
+}
+
 FChatCommandResponse AIChatCommandManager::ServerAutoRecord(AIPlayerController* CallingPlayer, TArray<FString> Params)
 {
 	if (Params.Num() < 2)
@@ -319,6 +319,9 @@ protected:
 
 	FChatCommandResponse ServerPerfTest(AIPlayerController* CallingPlayer, TArray<FString> Params);
 
+	// Usage: /ServerBenchmark <Name> [Iterations]
+	FChatCommandResponse ServerBenchmark(AIPlayerController* CallingPlayer, TArray<FString> Params);
+
 	FChatCommandResponse SetNewMovementCommand(AIPlayerController* CallingPlayer, TArray<FString> Params);
 
 	FChatCommandResponse ClearCooldownsCommand(AIPlayerController* CallingPlayer, TArray<FString> Params);
@@ -0,0 +1,659 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#include "POIRegistrySubsystem.h"
+#include "Quests/IPointOfInterest.h"
+#include "Quests/IPOI.h"
+#include "World/IWater.h"
+#include "Components/SphereComponent.h"
+#include "Engine/BlockingVolume.h"
+#include "Engine/Level.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "LandscapeProxy.h"
+#include "Algo/Sort.h"
+
+static TAutoConsoleVariable<int32> CVarPoiLandingCacheSamples(
+	TEXT("pot.PoiLandingCacheSamples"),
+	48,
+	TEXT("Number of random points traced around each POI when building its teleport landing cache."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPoiLandingCacheSamplesPerFrame(
+	TEXT("pot.PoiLandingCacheSamplesPerFrame"),
+	16,
+	TEXT("Maximum number of landing point samples whose async traces are started each frame."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPoiLandingCacheLifetime(
+	TEXT("pot.PoiLandingCacheLifetime"),
+	600.0f,
+	TEXT("Seconds before a POI landing cache is considered stale and traced again the next time it is used.\n")
+	TEXT(" <= 0: never rebuild"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPoiLandingBurstWindow(
+	TEXT("pot.PoiLandingBurstWindow"),
+	10.0f,
+	TEXT("Seconds since the last teleport to a POI before its cached landing points can be handed out again.\n")
+	TEXT("Teleports within the window get distinct points and trace themselves once the cache is used up."),
+	ECVF_Default);
+
+// Capsule half heights landing points are traced clear of blocking volumes for while the cache is built.
+// A teleport draws from the smallest class that fits, actors taller than the last class always trace for themselves.
+static constexpr float PoiLandingClassHalfHeights[] = { 0.0f, 100.0f, 200.0f, 400.0f, 800.0f, 1600.0f };
+static constexpr int32 NumPoiLandingClasses = UE_ARRAY_COUNT(PoiLandingClassHalfHeights);
+
+// Sample ids share the async trace user data with the trace slot in the low bits
+static constexpr uint32 LandingSlotBits = 3;
+static constexpr uint32 LandingSlotMask = (1u << LandingSlotBits) - 1;
+static constexpr uint32 LandingSampleIdMask = MAX_uint32 >> LandingSlotBits;
+
+static_assert(NumPoiLandingClasses <= (1 << LandingSlotBits), "Every landing class needs its own trace slot");
+static_assert(NumPoiLandingClasses <= 8, "Landing class masks are a uint8");
+
+UPOIRegistrySubsystem* UPOIRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UPOIRegistrySubsystem>() : nullptr;
+}
+
+void UPOIRegistrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// AIPointOfInterest first, name lookups used to prefer them over AIPOI
+	for (TActorIterator<AIPointOfInterest> It(&InWorld); It; ++It)
+	{
+		RegisterPoi(*It);
+	}
+
+	for (TActorIterator<AIPOI> It(&InWorld); It; ++It)
+	{
+		RegisterPoi(*It);
+	}
+
+	ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UPOIRegistrySubsystem::OnActorSpawned));
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UPOIRegistrySubsystem::OnLevelAddedToWorld);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UPOIRegistrySubsystem::OnLevelRemovedFromWorld);
+
+	bCacheLandingPoints = InWorld.GetNetMode() != NM_Client;
+	if (bCacheLandingPoints)
+	{
+		GroundTraceDelegate.BindUObject(this, &UPOIRegistrySubsystem::OnGroundTraceDone);
+		VolumeTraceDelegate.BindUObject(this, &UPOIRegistrySubsystem::OnVolumeTraceDone);
+
+		for (const TPair<TObjectKey<AActor>, FString>& Pair : NameByPoi)
+		{
+			QueueLandingCacheBuild(Pair.Key.ResolveObjectPtr());
+		}
+	}
+}
+
+void UPOIRegistrySubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+
+	ActorSpawnedHandle.Reset();
+
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	LevelAddedHandle.Reset();
+	LevelRemovedHandle.Reset();
+
+	PoisByName.Reset();
+	NameByPoi.Reset();
+
+	// Traces still in flight find no pending sample and are dropped
+	bCacheLandingPoints = false;
+	LandingCaches.Reset();
+	LandingBuildQueue.Reset();
+	PendingSamples.Reset();
+	GroundTraceDelegate.Unbind();
+	VolumeTraceDelegate.Unbind();
+
+	Super::Deinitialize();
+}
+
+void UPOIRegistrySubsystem::OnActorSpawned(AActor* Actor)
+{
+	if (IsPoi(Actor))
+	{
+		RegisterPoi(Actor);
+	}
+}
+
+void UPOIRegistrySubsystem::OnLevelAddedToWorld(ULevel* InLevel, UWorld* InWorld)
+{
+	if (!InLevel || InWorld != GetWorld())
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UPOIRegistrySubsystem::OnLevelAddedToWorld"))
+
+	// AIPointOfInterest first, same order as OnWorldBeginPlay
+	for (AActor* Actor : InLevel->Actors)
+	{
+		if (Cast<AIPointOfInterest>(Actor))
+		{
+			RegisterPoi(Actor);
+		}
+	}
+
+	for (AActor* Actor : InLevel->Actors)
+	{
+		if (Cast<AIPOI>(Actor))
+		{
+			RegisterPoi(Actor);
+		}
+	}
+}
+
+void UPOIRegistrySubsystem::OnLevelRemovedFromWorld(ULevel* InLevel, UWorld* InWorld)
+{
+	if (InWorld != GetWorld())
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UPOIRegistrySubsystem::OnLevelRemovedFromWorld"))
+
+	// Streamed out actors aren't destroyed, so OnPoiDestroyed never fires for them
+	TArray<AActor*> PoisToRemove;
+	for (const TPair<TObjectKey<AActor>, FString>& Pair : NameByPoi)
+	{
+		AActor* const Poi = Pair.Key.ResolveObjectPtr();
+		if (Poi && (!InLevel || Poi->GetLevel() == InLevel))
+		{
+			PoisToRemove.Add(Poi);
+		}
+	}
+
+	for (AActor* Poi : PoisToRemove)
+	{
+		UnregisterPoi(Poi);
+	}
+}
+
+void UPOIRegistrySubsystem::OnPoiDestroyed(AActor* DestroyedActor)
+{
+	UnregisterPoi(DestroyedActor);
+}
+
+bool UPOIRegistrySubsystem::IsPoi(const AActor* Actor)
+{
+	return Actor && (Actor->IsA<AIPointOfInterest>() || Actor->IsA<AIPOI>());
+}
+
+FString UPOIRegistrySubsystem::GetPoiName(const AActor* Poi)
+{
+	if (const AIPointOfInterest* IPointOfInterest = Cast<AIPointOfInterest>(Poi))
+	{
+		return IPointOfInterest->GetLocationTag().ToString();
+	}
+
+	if (const AIPOI* IPoi = Cast<AIPOI>(Poi))
+	{
+		return IPoi->GetLocationTag().ToString();
+	}
+
+	return FString();
+}
+
+float UPOIRegistrySubsystem::ComputePoiRadius(const AActor* Poi)
+{
+	if (const AIPointOfInterest* IPointOfInterest = Cast<AIPointOfInterest>(Poi))
+	{
+		if (const USphereComponent* TriggerSphere = Cast<USphereComponent>(IPointOfInterest->GetCollisionComponent()))
+		{
+			return TriggerSphere->GetScaledSphereRadius();
+		}
+	}
+
+	// POI did not have a sphere component, we can try to get the bounds of a static mesh
+	if (const AIPOI* IPoi = Cast<AIPOI>(Poi))
+	{
+		if (IPoi->GetMesh())
+		{
+			FVector Min, Max;
+			IPoi->GetMesh()->GetLocalBounds(Min, Max);
+			const FVector Difference = Max - Min;
+			if (Difference.Size() > KINDA_SMALL_NUMBER)
+			{
+				return FMath::Max3(Difference.X, Difference.Y, Difference.Z) / 4.0f;
+			}
+		}
+	}
+
+	return 1000.0f;
+}
+
+void UPOIRegistrySubsystem::RegisterPoi(AActor* Poi)
+{
+	if (!IsPoi(Poi) || NameByPoi.Contains(Poi))
+	{
+		return;
+	}
+
+	const FString Key = GetPoiName(Poi);
+
+	FPoiRegistryGroup& Group = PoisByName.FindOrAdd(Key);
+	if (Group.Entries.Num() == 0)
+	{
+		Group.DisplayName = Key;
+	}
+
+	FPoiRegistryEntry& Entry = Group.Entries.AddDefaulted_GetRef();
+	Entry.Actor = Poi;
+	Entry.Location = Poi->GetActorLocation();
+	Entry.Radius = ComputePoiRadius(Poi);
+	Entry.Bounds = Poi->GetComponentsBoundingBox(true);
+
+	NameByPoi.Add(Poi, Key);
+	Poi->OnDestroyed.AddUniqueDynamic(this, &UPOIRegistrySubsystem::OnPoiDestroyed);
+
+	if (bCacheLandingPoints)
+	{
+		QueueLandingCacheBuild(Poi);
+	}
+}
+
+void UPOIRegistrySubsystem::UnregisterPoi(AActor* Poi)
+{
+	FString Key;
+	if (!Poi || !NameByPoi.RemoveAndCopyValue(Poi, Key))
+	{
+		return;
+	}
+
+	Poi->OnDestroyed.RemoveDynamic(this, &UPOIRegistrySubsystem::OnPoiDestroyed);
+
+	// Samples still in flight for this POI are dropped when they complete
+	LandingCaches.Remove(Poi);
+
+	if (FPoiRegistryGroup* Group = PoisByName.Find(Key))
+	{
+		Group->Entries.RemoveAll([Poi](const FPoiRegistryEntry& Entry)
+		{
+			return Entry.Actor.Get() == Poi || !Entry.Actor.IsValid();
+		});
+
+		if (Group->Entries.Num() == 0)
+		{
+			PoisByName.Remove(Key);
+		}
+	}
+}
+
+const FPoiRegistryGroup* UPOIRegistrySubsystem::FindPois(const FString& PoiName) const
+{
+	return PoisByName.Find(PoiName);
+}
+
+const FPoiRegistryEntry* UPOIRegistrySubsystem::FindEntry(const AActor* Poi) const
+{
+	const FString* Key = NameByPoi.Find(Poi);
+	const FPoiRegistryGroup* Group = Key ? PoisByName.Find(*Key) : nullptr;
+	if (!Group)
+	{
+		return nullptr;
+	}
+
+	return Group->Entries.FindByPredicate([Poi](const FPoiRegistryEntry& Entry)
+	{
+		return Entry.Actor.Get() == Poi;
+	});
+}
+
+void UPOIRegistrySubsystem::GetPoiNames(TArray<FString>& OutNames) const
+{
+	OutNames.Reset(PoisByName.Num());
+	for (const TPair<FString, FPoiRegistryGroup>& Pair : PoisByName)
+	{
+		OutNames.Add(Pair.Value.DisplayName);
+	}
+}
+
+TStatId UPOIRegistrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPOIRegistrySubsystem, STATGROUP_Tickables);
+}
+
+void UPOIRegistrySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bCacheLandingPoints || LandingBuildQueue.Num() == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UPOIRegistrySubsystem::Tick"))
+
+	const int32 NumSamples = FMath::Max(1, CVarPoiLandingCacheSamples.GetValueOnGameThread());
+	int32 Budget = FMath::Max(1, CVarPoiLandingCacheSamplesPerFrame.GetValueOnGameThread());
+
+	int32 QueueIndex = 0;
+	while (Budget > 0 && QueueIndex < LandingBuildQueue.Num())
+	{
+		AActor* const Poi = LandingBuildQueue[QueueIndex].Get();
+		FPoiLandingCache* const Cache = Poi ? LandingCaches.Find(Poi) : nullptr;
+		if (!Cache)
+		{
+			QueueIndex++;
+			continue;
+		}
+
+		if (!Cache->bBuilding)
+		{
+			Cache->bBuilding = true;
+			Cache->BuildId = NextBuildId++;
+			Cache->Next = FPoiLandingPoints();
+			Cache->NumSamplesIssued = 0;
+			Cache->NumSamplesCompleted = 0;
+		}
+
+		while (Budget > 0 && Cache->NumSamplesIssued < NumSamples)
+		{
+			IssueLandingSample(Poi, *Cache);
+			Budget--;
+		}
+
+		if (Cache->NumSamplesIssued < NumSamples)
+		{
+			break;
+		}
+
+		// Everything for this POI is in flight, the cache swaps over once the last sample completes
+		Cache->bQueued = false;
+		QueueIndex++;
+	}
+
+	LandingBuildQueue.RemoveAt(0, QueueIndex, false);
+}
+
+void UPOIRegistrySubsystem::QueueLandingCacheBuild(AActor* Poi)
+{
+	if (!Poi)
+	{
+		return;
+	}
+
+	FPoiLandingCache& Cache = LandingCaches.FindOrAdd(Poi);
+	if (Cache.bQueued || Cache.bBuilding)
+	{
+		return;
+	}
+
+	Cache.bQueued = true;
+	LandingBuildQueue.Add(Poi);
+}
+
+void UPOIRegistrySubsystem::IssueLandingSample(AActor* Poi, FPoiLandingCache& Cache)
+{
+	UWorld* const World = GetWorld();
+	check(World);
+
+	const FPoiRegistryEntry* const PoiEntry = FindEntry(Poi);
+	const float PoiRadius = PoiEntry ? PoiEntry->Radius : ComputePoiRadius(Poi);
+
+	const uint32 SampleId = NextSampleId;
+	NextSampleId = (NextSampleId + 1) & LandingSampleIdMask;
+
+	FPendingLandingSample& Sample = PendingSamples.Add(SampleId);
+	Sample.Poi = Poi;
+	Sample.BuildId = Cache.BuildId;
+	Sample.PoiLocation = Poi->GetActorLocation();
+
+	// Same distribution as AIChatCommandManager::InternalGetLocationFromPoi
+	Sample.SampleLocation = Sample.PoiLocation + ((FMath::VRand() * FVector{ 1, 1, 0 }) * PoiRadius);
+	Sample.NumTracesPending = 2;
+
+	Cache.NumSamplesIssued++;
+
+	const FVector StartVector = Sample.SampleLocation + FVector(0, 0, 100000);
+	const FVector EndVector = Sample.SampleLocation - FVector(0, 0, 100000);
+
+	// Overlap response makes the multi trace return every hit along the line instead of stopping at the first block
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(PoiLandingGroundTrace), false);
+	const FCollisionResponseParams ResponseParams(ECR_Overlap);
+
+	const uint32 UserData = SampleId << LandingSlotBits;
+	World->AsyncLineTraceByChannel(EAsyncTraceType::Multi, StartVector, EndVector, COLLISION_DINOCAPSULE, QueryParams, ResponseParams, &GroundTraceDelegate, UserData);
+	World->AsyncLineTraceByChannel(EAsyncTraceType::Multi, StartVector, EndVector, ECC_WorldStatic, QueryParams, ResponseParams, &GroundTraceDelegate, UserData | 1);
+}
+
+void UPOIRegistrySubsystem::OnGroundTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	const uint32 SampleId = TraceDatum.UserData >> LandingSlotBits;
+	FPendingLandingSample* const Sample = PendingSamples.Find(SampleId);
+	if (!Sample)
+	{
+		return;
+	}
+
+	Sample->GroundHits.Append(TraceDatum.OutHits);
+	if (--Sample->NumTracesPending == 0)
+	{
+		ClassifyLandingSample(SampleId, *Sample);
+	}
+}
+
+void UPOIRegistrySubsystem::ClassifyLandingSample(uint32 SampleId, FPendingLandingSample& Sample)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UPOIRegistrySubsystem::ClassifyLandingSample"))
+
+	UWorld* const World = GetWorld();
+	if (!World || !LandingCaches.Contains(Sample.Poi))
+	{
+		CompleteLandingSample(SampleId);
+		return;
+	}
+
+	const FVector StartVector = Sample.SampleLocation + FVector(0, 0, 100000);
+	Algo::Sort(Sample.GroundHits, [&StartVector](const FHitResult& Lhs, const FHitResult& Rhs) {
+		return FVector::DistSquared(StartVector, Lhs.ImpactPoint) < FVector::DistSquared(StartVector, Rhs.ImpactPoint);
+	});
+
+	// Mirrors InternalGetLocationFromPoi, the first land or water surface below the sky decides the point
+	bool bFoundSurface = false;
+	for (const FHitResult& Result : Sample.GroundHits)
+	{
+		const AActor* const HitActor = Result.GetActor();
+		if (Cast<ABlockingVolume>(HitActor))
+		{
+			continue;
+		}
+
+		if (Cast<AIWater>(HitActor))
+		{
+			Sample.bWater = true;
+			Sample.ImpactPoint = Result.ImpactPoint;
+			bFoundSurface = true;
+			break;
+		}
+
+		if (Cast<ALandscapeProxy>(HitActor) || Cast<AStaticMeshActor>(HitActor))
+		{
+			Sample.ImpactPoint = Result.ImpactPoint;
+			bFoundSurface = true;
+			break;
+		}
+	}
+
+	Sample.GroundHits.Empty();
+
+	if (!bFoundSurface)
+	{
+		CompleteLandingSample(SampleId);
+		return;
+	}
+
+	// Make sure that there is no blocking volume between the player spawn location and the POI, for each capsule size on land
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(PoiLandingVolumeTrace), false);
+	const FCollisionResponseParams ResponseParams(ECR_Overlap);
+
+	const int32 NumClasses = Sample.bWater ? 1 : NumPoiLandingClasses;
+	Sample.bCheckingVolumes = true;
+	Sample.NumTracesPending = NumClasses;
+
+	for (int32 ClassIndex = 0; ClassIndex < NumClasses; ClassIndex++)
+	{
+		const FVector Location = Sample.ImpactPoint + FVector(0, 0, PoiLandingClassHalfHeights[ClassIndex]);
+		World->AsyncLineTraceByChannel(EAsyncTraceType::Multi, Sample.PoiLocation, Location, ECC_WorldStatic, QueryParams, ResponseParams, &VolumeTraceDelegate, (SampleId << LandingSlotBits) | ClassIndex);
+	}
+}
+
+void UPOIRegistrySubsystem::OnVolumeTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	const uint32 SampleId = TraceDatum.UserData >> LandingSlotBits;
+	const uint32 ClassIndex = TraceDatum.UserData & LandingSlotMask;
+
+	FPendingLandingSample* const Sample = PendingSamples.Find(SampleId);
+	if (!Sample || !Sample->bCheckingVolumes)
+	{
+		return;
+	}
+
+	const bool bBlocked = TraceDatum.OutHits.ContainsByPredicate([](const FHitResult& Hit)
+	{
+		return Cast<ABlockingVolume>(Hit.GetActor()) != nullptr;
+	});
+
+	if (!bBlocked)
+	{
+		Sample->ClearClassMask |= 1 << ClassIndex;
+	}
+
+	if (--Sample->NumTracesPending == 0)
+	{
+		CompleteLandingSample(SampleId);
+	}
+}
+
+void UPOIRegistrySubsystem::CompleteLandingSample(uint32 SampleId)
+{
+	FPendingLandingSample Sample;
+	if (!PendingSamples.RemoveAndCopyValue(SampleId, Sample))
+	{
+		return;
+	}
+
+	// The POI was destroyed (or unregistered and registered again) while its traces were in flight
+	FPoiLandingCache* const Cache = LandingCaches.Find(Sample.Poi);
+	if (!Cache || !Cache->bBuilding || Cache->BuildId != Sample.BuildId)
+	{
+		return;
+	}
+
+	if (Sample.bWater)
+	{
+		if (Sample.ClearClassMask & 1)
+		{
+			Cache->Next.WaterPoints.Add(Sample.ImpactPoint);
+		}
+	}
+	else if (Sample.ClearClassMask != 0)
+	{
+		Cache->Next.LandPoints.Add(Sample.ImpactPoint);
+		Cache->Next.LandClassMasks.Add(Sample.ClearClassMask);
+	}
+
+	Cache->NumSamplesCompleted++;
+	if (!Cache->bQueued && Cache->NumSamplesCompleted >= Cache->NumSamplesIssued)
+	{
+		Cache->Current = MoveTemp(Cache->Next);
+		Cache->Current.BuiltTime = FPlatformTime::Seconds();
+		Cache->Next = FPoiLandingPoints();
+		Cache->UsedWaterPoints.Init(false, Cache->Current.WaterPoints.Num());
+		Cache->UsedLandPoints.Init(false, Cache->Current.LandPoints.Num());
+		Cache->bBuilding = false;
+	}
+}
+
+bool UPOIRegistrySubsystem::DrawLandingPoint(AActor* Poi, bool bAllowWater, float ActorHalfHeight, FVector& OutLocation)
+{
+	FPoiLandingCache* const Cache = Poi ? LandingCaches.Find(Poi) : nullptr;
+	if (!Cache)
+	{
+		return false;
+	}
+
+	// Stale caches keep serving until the rebuild has been traced
+	const float Lifetime = CVarPoiLandingCacheLifetime.GetValueOnGameThread();
+	if (Lifetime > 0.0f && Cache->Current.BuiltTime >= 0.0 && FPlatformTime::Seconds() - Cache->Current.BuiltTime > Lifetime)
+	{
+		QueueLandingCacheBuild(Poi);
+	}
+
+	int32 ClassIndex = 0;
+	while (ClassIndex < NumPoiLandingClasses && PoiLandingClassHalfHeights[ClassIndex] < ActorHalfHeight)
+	{
+		ClassIndex++;
+	}
+
+	// Taller than anything the cache was traced for
+	if (ClassIndex == NumPoiLandingClasses)
+	{
+		return false;
+	}
+
+	// The caller lands somewhere between the heights of the classes up to ClassIndex, all of them must have been clear
+	const uint8 RequiredClassMask = static_cast<uint8>((2 << ClassIndex) - 1);
+
+	FPoiLandingPoints& Points = Cache->Current;
+
+	// A new burst of teleports can reuse every point again
+	const double Now = FPlatformTime::Seconds();
+	if (Cache->LastDrawTime < 0.0 || Now - Cache->LastDrawTime > CVarPoiLandingBurstWindow.GetValueOnGameThread())
+	{
+		Cache->UsedWaterPoints.Init(false, Points.WaterPoints.Num());
+		Cache->UsedLandPoints.Init(false, Points.LandPoints.Num());
+	}
+	Cache->LastDrawTime = Now;
+
+	// Water points are stored after the land points
+	TArray<int32, TInlineAllocator<64>> Candidates;
+	for (int32 PointIndex = 0; PointIndex < Points.LandPoints.Num(); PointIndex++)
+	{
+		if (!Cache->UsedLandPoints[PointIndex] && (Points.LandClassMasks[PointIndex] & RequiredClassMask) == RequiredClassMask)
+		{
+			Candidates.Add(PointIndex);
+		}
+	}
+
+	if (bAllowWater)
+	{
+		for (int32 PointIndex = 0; PointIndex < Points.WaterPoints.Num(); PointIndex++)
+		{
+			if (!Cache->UsedWaterPoints[PointIndex])
+			{
+				Candidates.Add(Points.LandPoints.Num() + PointIndex);
+			}
+		}
+	}
+
+	if (Candidates.Num() == 0)
+	{
+		return false;
+	}
+
+	// Already validated while the cache was traced, no traces on the game thread here
+	const int32 PointIndex = Candidates[FMath::RandRange(0, Candidates.Num() - 1)];
+	if (PointIndex < Points.LandPoints.Num())
+	{
+		Cache->UsedLandPoints[PointIndex] = true;
+		OutLocation = Points.LandPoints[PointIndex] + FVector(0, 0, ActorHalfHeight);
+	}
+	else
+	{
+		Cache->UsedWaterPoints[PointIndex - Points.LandPoints.Num()] = true;
+		OutLocation = Points.WaterPoints[PointIndex - Points.LandPoints.Num()];
+	}
+
+	return true;
+}
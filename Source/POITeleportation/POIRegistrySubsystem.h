@@ -0,0 +1,159 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "POIRegistrySubsystem.generated.h"
+
+// A registered point of interest with its teleport radius and bounds worked out once
+struct FPoiRegistryEntry
+{
+	TWeakObjectPtr<AActor> Actor;
+	FVector Location = FVector::ZeroVector;
+	float Radius = 1000.0f;
+	FBox Bounds = FBox(ForceInit);
+};
+
+// All points of interest sharing a location tag, compared case-insensitively
+struct FPoiRegistryGroup
+{
+	// Location tag as authored, used when listing POIs
+	FString DisplayName;
+	TArray<FPoiRegistryEntry> Entries;
+};
+
+// Landing points around a POI that already passed the ground and blocking volume traces
+struct FPoiLandingPoints
+{
+	// Water surface impact points, no blocking volume between them and the POI
+	TArray<FVector> WaterPoints;
+
+	// Ground impact points, bit N of the matching class mask is set when the capsule centre for landing class N above it is clear of blocking volumes
+	TArray<FVector> LandPoints;
+	TArray<uint8> LandClassMasks;
+
+	double BuiltTime = -1.0;
+};
+
+struct FPoiLandingCache
+{
+	// Served to teleports while Next is being traced
+	FPoiLandingPoints Current;
+	FPoiLandingPoints Next;
+
+	// Points of Current already handed out this burst, they aren't drawn again until the burst ends
+	TBitArray<> UsedWaterPoints;
+	TBitArray<> UsedLandPoints;
+	double LastDrawTime = -1.0;
+
+	// Samples of an older build (or an earlier registration of the same actor) don't match and are dropped
+	uint32 BuildId = 0;
+
+	int32 NumSamplesIssued = 0;
+	int32 NumSamplesCompleted = 0;
+	bool bBuilding = false;
+	bool bQueued = false;
+};
+
+// A candidate landing point waiting on its async traces
+struct FPendingLandingSample
+{
+	TObjectKey<AActor> Poi;
+	uint32 BuildId = 0;
+	FVector PoiLocation = FVector::ZeroVector;
+	FVector SampleLocation = FVector::ZeroVector;
+	FVector ImpactPoint = FVector::ZeroVector;
+	TArray<FHitResult> GroundHits;
+	int32 NumTracesPending = 0;
+	uint8 ClearClassMask = 0;
+	bool bWater = false;
+	bool bCheckingVolumes = false;
+};
+
+/**
+ * Name -> actor index of AIPointOfInterest and AIPOI actors so chat command teleports
+ * don't have to walk every actor in the world for each lookup.
+ * On the server it also keeps a cache of safe landing points per POI, traced asynchronously
+ * after level load and rebuilt lazily once stale, so teleports don't trace on the game thread.
+ */
+UCLASS()
+class PATHOFTITANS_API UPOIRegistrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UPOIRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	//FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// POIs are picked up at world begin play, when spawned and when their streaming level is added to the world
+	void RegisterPoi(AActor* Poi);
+	void UnregisterPoi(AActor* Poi);
+
+	// POIs with the given location tag in registration order, nullptr if there are none
+	const FPoiRegistryGroup* FindPois(const FString& PoiName) const;
+
+	// Cached entry for a registered POI actor
+	const FPoiRegistryEntry* FindEntry(const AActor* Poi) const;
+
+	// Location tags of every registered POI, once per tag
+	void GetPoiNames(TArray<FString>& OutNames) const;
+
+	static bool IsPoi(const AActor* Actor);
+	static FString GetPoiName(const AActor* Poi);
+
+	// Teleport radius of a POI, from its trigger sphere or a quarter of its mesh size
+	static float ComputePoiRadius(const AActor* Poi);
+
+	/**
+	 * Picks a random cached landing point around the POI that hasn't been handed out in the current burst and
+	 * was traced clear of blocking volumes up to the smallest landing class fitting ActorHalfHeight. Land points are raised by ActorHalfHeight.
+	 * Returns false if nothing is cached yet, every point is used up or the actor is taller than every class, callers then trace themselves.
+	 */
+	bool DrawLandingPoint(AActor* Poi, bool bAllowWater, float ActorHalfHeight, FVector& OutLocation);
+
+private:
+	void OnActorSpawned(AActor* Actor);
+	void OnLevelAddedToWorld(ULevel* InLevel, UWorld* InWorld);
+	void OnLevelRemovedFromWorld(ULevel* InLevel, UWorld* InWorld);
+
+	UFUNCTION()
+	void OnPoiDestroyed(AActor* DestroyedActor);
+
+	void QueueLandingCacheBuild(AActor* Poi);
+	void IssueLandingSample(AActor* Poi, FPoiLandingCache& Cache);
+	void OnGroundTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+	void OnVolumeTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+	void ClassifyLandingSample(uint32 SampleId, FPendingLandingSample& Sample);
+	void CompleteLandingSample(uint32 SampleId);
+
+	// Keyed by location tag, FString keys already compare case-insensitively
+	TMap<FString, FPoiRegistryGroup> PoisByName;
+	TMap<TObjectKey<AActor>, FString> NameByPoi;
+
+	TMap<TObjectKey<AActor>, FPoiLandingCache> LandingCaches;
+
+	// POIs waiting for their landing cache to be traced, in the order they were queued
+	TArray<TWeakObjectPtr<AActor>> LandingBuildQueue;
+
+	TMap<uint32, FPendingLandingSample> PendingSamples;
+	uint32 NextSampleId = 0;
+	uint32 NextBuildId = 1;
+
+	FTraceDelegate GroundTraceDelegate;
+	FTraceDelegate VolumeTraceDelegate;
+
+	// Only the server teleports players, set once the world has begun play
+	bool bCacheLandingPoints = false;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+};
@@ -850,6 +850,52 @@ void UIQuest::Update(AIBaseCharacter* QuestOwner, UIQuest* ActiveQuest)
 	}
 }
 
+int32 UIQuest::UpdateForQuestEvents(AIBaseCharacter* QuestOwner, FQuestEventMask Events)
+{
+	if (!IsValid(QuestData))
+	{
+		return 0;
+	}
+
+	int32 NumTasksUpdated = 0;
+
+	if (QuestData->bInOrderQuestTasks)
+	{
+		UIQuestBaseTask* ActiveTask = GetActiveTask();
+		if (ActiveTask && (ActiveTask->GetSubscribedQuestEvents() & Events))
+		{
+			ActiveTask->Update(QuestOwner, this);
+			NumTasksUpdated++;
+		}
+	}
+	else
+	{
+		for (UIQuestBaseTask* QuestBaseTask : GetQuestTasks())
+		{
+			if (QuestBaseTask && (QuestBaseTask->GetSubscribedQuestEvents() & Events))
+			{
+				QuestBaseTask->Update(QuestOwner, this);
+				NumTasksUpdated++;
+			}
+		}
+	}
+
+	return NumTasksUpdated;
+}
+
+FQuestEventMask UIQuest::GetSubscribedQuestEvents() const
+{
+	FQuestEventMask Events = 0;
+	for (const UIQuestBaseTask* QuestBaseTask : GetQuestTasks())
+	{
+		if (QuestBaseTask)
+		{
+			Events |= QuestBaseTask->GetSubscribedQuestEvents();
+		}
+	}
+	return Events;
+}
+
 bool UIQuest::ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch, FReplicationFlags* RepFlags)
 {
 	bool bWrite = Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
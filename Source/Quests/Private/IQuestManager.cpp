@@ -31,6 +31,16 @@
 #include "Critters/ICritterPawn.h"
 #include "AlderonCritterController.h"
 #include "UI/IGameHUD.h"
+#include "AbilitySystemComponent.h"
+#include "Abilities/CoreAttributeSet.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+
+static TAutoConsoleVariable<int32> CVarQuestFallbackSweepInterval(
+	TEXT("pot.QuestFallbackSweepInterval"),
+	5,
+	TEXT("Quest ticks between full quest sweeps. Between sweeps only quests subscribed to a published quest event are updated."),
+	ECVF_Default);
 
 AIQuestManager::AIQuestManager()
 {
@@ -177,6 +187,15 @@ void AIQuestManager::LoadContributionData()
 		ActiveWaystoneRestoreQuestTags = QuestContributionsSave->SavedWaystoneRestoreQuestTags;
 	}
 
+	ContributionExpiries.Reset();
+	for (const FQuestContribution& QuestContribution : GetQuestContributions())
+	{
+		if (QuestContribution.Timestamp != 0.0f)
+		{
+			ContributionExpiries.HeapPush(FQuestExpiry(QuestContribution.Timestamp, QuestContribution.QuestId, QuestContribution.CharacterID));
+		}
+	}
+
 	// Ignore timestamps from a save
 	// TODO: (Erlite) Note: this makes a copy, the code below does literally nothing. As such, I disabled it. Kept it for future review though.
 	// TArray<FQuestContribution> RelevantQuestContributions = QuestContributions; <--- COPY, NOT BY REF, BAD
@@ -227,33 +246,24 @@ void AIQuestManager::OnSaveContributionData(TArray<FPrimaryAssetId> QuestAssetId
 	USaveGame_QuestContributions* QuestContributionsSave = Cast<USaveGame_QuestContributions>(UGameplayStatics::CreateSaveGameObject(USaveGame_QuestContributions::StaticClass()));
 	QuestContributionsSave->Version = IAlderonCommon::Get().GetFullVersion();
 
+	// Group contributions aren't saved, hashed so the merge is a single pass over the contributions
+	const TSet<FPrimaryAssetId> GroupQuestIds(QuestAssetIds);
+
 	// Reset timestamps back to 0 that have been completed to allow player time to relog in to claim their contribution.
-	TArray<FQuestContribution> RelevantQuestContributions = GetQuestContributions();
+	TArray<FQuestContribution>& RelevantQuestContributions = QuestContributionsSave->SavedQuestContributions;
+	RelevantQuestContributions.Reset(GetQuestContributions().Num());
 
-	for (int32 i = RelevantQuestContributions.Num(); i-- > 0;)
+	for (const FQuestContribution& QuestContribution : GetQuestContributions())
 	{
-		bool bIsGroupContribution = false;
-		FQuestContribution& QuestContribution = RelevantQuestContributions[i];
+		if (GroupQuestIds.Contains(QuestContribution.QuestId)) continue;
 
-		for (const FPrimaryAssetId& GroupQuestId : QuestAssetIds)
-		{
-			if (QuestContribution.QuestId == GroupQuestId)
-			{
-				RelevantQuestContributions.RemoveAt(i);
-				bIsGroupContribution = true;
-				break;
-			}
-		}
-
-		if (bIsGroupContribution) continue;
-
-		if (QuestContribution.Timestamp != 0.0f)
+		FQuestContribution& SavedContribution = RelevantQuestContributions.Add_GetRef(QuestContribution);
+		if (SavedContribution.Timestamp != 0.0f)
 		{
-			QuestContribution.Timestamp = 1.0f;
+			SavedContribution.Timestamp = 1.0f;
 		}
 	}
 
-	QuestContributionsSave->SavedQuestContributions = RelevantQuestContributions;
 	QuestContributionsSave->SavedWaterRestorationQuestTags = ActiveWaterRestorationQuestTags;
 	QuestContributionsSave->SavedWaystoneRestoreQuestTags = ActiveWaystoneRestoreQuestTags;
 
@@ -285,9 +295,8 @@ void AIQuestManager::QuestTick()
 	const AIGameState* const IGameState = UIGameplayStatics::GetIGameState(this);
 	if (!IGameState) return;
 
-	//save data for completed feed group member quests to call GroupQuestResult logic on
-	AIPlayerGroupActor* FeedMemberCleanupGroupActor = nullptr;
-	UIQuest* FeedMemberQuestToCleanup = nullptr;
+	TArray<FQuestTickParticipant, TInlineAllocator<128>> Participants;
+	Participants.Reserve(IGameState->PlayerArray.Num());
 
 	for (const APlayerState* const PlayerState : IGameState->PlayerArray)
 	{
@@ -305,125 +314,475 @@ void AIQuestManager::QuestTick()
 			continue;
 		}
 
-		// Backwards For Loop as quests can be removed when they are completed
-		// Intentionally backwards because you can't do this forwards without
-		// invalidating the array or length
-		for (int32 Index = OwningCharacter->GetActiveQuests().Num() - 1; Index >= 0; --Index)
+		Participants.Emplace(PlayerState, OwningCharacter);
+	}
+
+	TickQuests(Participants);
+}
+
+void AIQuestManager::TickQuests(TConstArrayView<FQuestTickParticipant> Participants)
+{
+	// The fallback sweep picks up time based progress and anything that changed without publishing an event
+	const bool bFullSweep = ++QuestTicksSinceSweep >= FMath::Max(1, CVarQuestFallbackSweepInterval.GetValueOnGameThread());
+	if (bFullSweep)
+	{
+		QuestTicksSinceSweep = 0;
+		QuestStatSweepId++;
+	}
+
+	const TMap<TObjectKey<AIBaseCharacter>, FQuestEventMask> CharacterEvents = MoveTemp(PendingQuestEvents);
+	PendingQuestEvents.Reset();
+
+	const FQuestEventMask GlobalEvents = bFullSweep ? AllQuestEvents : PendingGlobalQuestEvents;
+	PendingGlobalQuestEvents = 0;
+
+	//save data for completed feed group member quests to call GroupQuestResult logic on
+	AIPlayerGroupActor* FeedMemberCleanupGroupActor = nullptr;
+	UIQuest* FeedMemberQuestToCleanup = nullptr;
+
+	for (const FQuestTickParticipant& Participant : Participants)
+	{
+		AIBaseCharacter* const OwningCharacter = Participant.Value;
+
+		FQuestEventMask Events = GlobalEvents;
+		if (const FQuestEventMask* const PublishedEvents = CharacterEvents.Find(OwningCharacter))
+		{
+			Events |= *PublishedEvents;
+		}
+
+		TickCharacterQuests(Participant.Key, OwningCharacter, Events, FeedMemberCleanupGroupActor, FeedMemberQuestToCleanup);
+	}
+
+	//replicate the logic of GroupQuestResult without actually calling GroupQuestResult and completing the quest additional times
+	if (FeedMemberCleanupGroupActor && FeedMemberQuestToCleanup)
+	{
+		FeedMemberCleanupGroupActor->RemoveGroupQuest(FeedMemberQuestToCleanup);
+
+		FeedMemberCleanupGroupActor->AssignGroupQuests();
+	}
+
+	if (bFullSweep)
+	{
+		PruneQuestStatWatches();
+
+		for (auto It = KillTaskIndices.CreateIterator(); It; ++It)
 		{
-			UIQuest* const ActiveQuest = OwningCharacter->GetActiveQuests()[Index];
-			if (!ActiveQuest || !ActiveQuest->IsValidLowLevel())
+			if (!It.Key().ResolveObjectPtr())
 			{
-				continue;
+				It.RemoveCurrent();
 			}
+		}
+	}
+}
+
+void AIQuestManager::TickCharacterQuests(const APlayerState* PlayerState, AIBaseCharacter* OwningCharacter, FQuestEventMask Events, AIPlayerGroupActor*& FeedMemberCleanupGroupActor, UIQuest*& FeedMemberQuestToCleanup)
+{
+	const bool bRefresh = (Events & QuestEventBit(EQuestEvent::Refresh)) != 0;
+
+	// Backwards For Loop as quests can be removed when they are completed
+	// Intentionally backwards because you can't do this forwards without
+	// invalidating the array or length
+	for (int32 Index = OwningCharacter->GetActiveQuests().Num() - 1; Index >= 0; --Index)
+	{
+		UIQuest* const ActiveQuest = OwningCharacter->GetActiveQuests()[Index];
+		if (!ActiveQuest || !ActiveQuest->IsValidLowLevel())
+		{
+			continue;
+		}
 
+		if (bRefresh)
+		{
 			ActiveQuest->Update(OwningCharacter, ActiveQuest);
+			WatchQuestStats(OwningCharacter, ActiveQuest);
+		}
+		else
+		{
+			const FQuestEventMask QuestEvents = Events & ActiveQuest->GetSubscribedQuestEvents();
+			const bool bTimed = ActiveQuest->QuestData && ActiveQuest->QuestData->TimeLimit > 0.0f;
 
-			const UQuestData* const QuestData = ActiveQuest->QuestData;
-			if (!QuestData || !QuestData->IsValidLowLevel())
+			// Nothing this quest listens to happened, timed quests still need their countdown
+			if (!QuestEvents && !bTimed)
 			{
 				continue;
 			}
 
-			if ((ActiveQuest->GetPlayerGroupActor() && !ActiveQuest->GetPlayerGroupActor()->GetGroupQuests().Contains(ActiveQuest)) || !QuestData->bEnabled)
+			if (QuestEvents)
 			{
-				GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Red, FString::Printf(TEXT("AIQuestManager::QuestTick() - Group doesn't contain quest")));
-				OnQuestFail(OwningCharacter, ActiveQuest);
-				continue;
+				ActiveQuest->UpdateForQuestEvents(OwningCharacter, QuestEvents);
 			}
+		}
+
+		const UQuestData* const QuestData = ActiveQuest->QuestData;
+		if (!QuestData || !QuestData->IsValidLowLevel())
+		{
+			continue;
+		}
+
+		if ((ActiveQuest->GetPlayerGroupActor() && !ActiveQuest->GetPlayerGroupActor()->GetGroupQuests().Contains(ActiveQuest)) || !QuestData->bEnabled)
+		{
+			GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Red, FString::Printf(TEXT("AIQuestManager::QuestTick() - Group doesn't contain quest")));
+			OnQuestFail(OwningCharacter, ActiveQuest);
+			continue;
+		}
 
-			//fail quests if character no longer meets gameplay tag requirements
-			if (!QuestData->RequiredGameplayTags.IsEmpty())
+		//fail quests if character no longer meets gameplay tag requirements
+		if (bRefresh && !QuestData->RequiredGameplayTags.IsEmpty() && !MeetsQuestRequiredTags(OwningCharacter, QuestData))
+		{
+			GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Red, FString::Printf(TEXT("AIQuestManager::QuestTick() - does not meet gameplay tag requirements")));
+			OnQuestFail(OwningCharacter, ActiveQuest);
+			continue;
+		}
+						
+		//do not skip OnQuestCompleted calls for feed group member quests if the leader is the hungry player
+		bool FeedMemberQuestWithTargetLeader = false;
+		if (ActiveQuest->QuestData->QuestType == EQuestType::GroupSurvival
+			&& ActiveQuest->GetPlayerGroupActor()
+			&& ActiveQuest->GetPlayerGroupActor()->GetGroupLeader())
+		{
+			for (const UIQuestBaseTask* const QuestTask : ActiveQuest->GetQuestTasks())
 			{
-				FGameplayTagContainer CharacterTags{};
-				if (UAbilitySystemComponent* AbilitySystemComponent = OwningCharacter->GetAbilitySystemComponent())
+				const UIQuestFeedMember* const FeedMemberTask = Cast<UIQuestFeedMember>(QuestTask);
+				if (!FeedMemberTask) continue;
+
+				if (!IsValid(FeedMemberTask->TargetMember)) continue;
+								
+				const AIPlayerState* const IPlayerState = FeedMemberTask->TargetMember->GetPlayerState<AIPlayerState>();
+				if (!IsValid(IPlayerState)) continue;
+
+				if (IPlayerState == ActiveQuest->GetPlayerGroupActor()->GetGroupLeader())
 				{
-					AbilitySystemComponent->GetOwnedGameplayTags(CharacterTags);
-					// certain quests should only be give to characters that can dive
-					// Ability.CanDive simply causes bAquatic to be set to true, but dinos with bAquatic == true do not necessarily have the CanDive tag
-					// if Character->IsAquatic() == true then the character can dive, this code block allows bp data assets to rely on Ability.CanDive as a required tag
-					if (OwningCharacter->IsAquatic())
-					{
-						CharacterTags.AddTag(UPOTAbilitySystemGlobals::Get().CanDiveTag);
-					}
+					FeedMemberQuestWithTargetLeader = true;
 				}
+			}
+		}
 
-				if (!CharacterTags.HasAll(QuestData->RequiredGameplayTags))
+		// Only process checks for Group Quests if it is from the Group Leader to save performance
+		if (ActiveQuest->GetPlayerGroupActor() && ActiveQuest->GetPlayerGroupActor()->GetGroupLeader() && ActiveQuest->GetPlayerGroupActor()->GetGroupLeader() != PlayerState && !FeedMemberQuestWithTargetLeader) continue;
+
+		if (!ActiveQuest->IsCompleted() || FeedMemberQuestWithTargetLeader)
+		{
+			// Check for quest completion
+			ActiveQuest->CheckCompletion();
+
+			if (ActiveQuest->IsCompleted())
+			{
+				// save data on feed member quest to cleanup after for loop
+				if (FeedMemberQuestWithTargetLeader)
 				{
-					GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Red, FString::Printf(TEXT("AIQuestManager::QuestTick() - does not meet gameplay tag requirements")));
-					OnQuestFail(OwningCharacter, ActiveQuest);
-					continue;
+					FeedMemberCleanupGroupActor = ActiveQuest->GetPlayerGroupActor();
+					FeedMemberQuestToCleanup = ActiveQuest;
+
+					FeedMemberCleanupGroupActor->RemoveGroupQuestFailure(FeedMemberQuestToCleanup->GetQuestId(), true);
 				}
+
+				OnQuestCompleted(OwningCharacter, ActiveQuest);
+				continue;
 			}
-							
-			//do not skip OnQuestCompleted calls for feed group member quests if the leader is the hungry player
-			bool FeedMemberQuestWithTargetLeader = false;
-			if (ActiveQuest->QuestData->QuestType == EQuestType::GroupSurvival
-				&& ActiveQuest->GetPlayerGroupActor()
-				&& ActiveQuest->GetPlayerGroupActor()->GetGroupLeader())
+
+			// Handle timed quests and failure
+			if (QuestData->TimeLimit > 0.0f && (!QuestData->bLeftAreaTimeLimit || ActiveQuest->IsFailureInbound()))
 			{
-				for (const UIQuestBaseTask* const QuestTask : ActiveQuest->GetQuestTasks())
+				if (ActiveQuest->GetRemainingTime() > 0)
 				{
-					const UIQuestFeedMember* const FeedMemberTask = Cast<UIQuestFeedMember>(QuestTask);
-					if (!FeedMemberTask) continue;
+					ActiveQuest->SetRemainingTime(ActiveQuest->GetRemainingTime() - 1);
+				}
+				else {
+					ActiveQuest->SetRemainingTime(0);
+					OnQuestFail(OwningCharacter, ActiveQuest);
+				}
+			}
+		}
+	}
+}
 
-					if (!IsValid(FeedMemberTask->TargetMember)) continue;
-									
-					const AIPlayerState* const IPlayerState = FeedMemberTask->TargetMember->GetPlayerState<AIPlayerState>();
-					if (!IsValid(IPlayerState)) continue;
+bool AIQuestManager::MeetsQuestRequiredTags(AIBaseCharacter* Character, const UQuestData* QuestData) const
+{
+	const UAbilitySystemComponent* const AbilitySystemComponent = Character->GetAbilitySystemComponent();
+	if (!AbilitySystemComponent)
+	{
+		return QuestData->RequiredGameplayTags.IsEmpty();
+	}
 
-					if (IPlayerState == ActiveQuest->GetPlayerGroupActor()->GetGroupLeader())
-					{
-						FeedMemberQuestWithTargetLeader = true;
-					}
-				}
+	// certain quests should only be give to characters that can dive
+	// Ability.CanDive simply causes bAquatic to be set to true, but dinos with bAquatic == true do not necessarily have the CanDive tag
+	// if Character->IsAquatic() == true then the character can dive, this code block allows bp data assets to rely on Ability.CanDive as a required tag
+	const bool bAquatic = Character->IsAquatic();
+	const FGameplayTag& CanDiveTag = UPOTAbilitySystemGlobals::Get().CanDiveTag;
+
+	// Checked tag by tag against the ability system so the owned tags don't have to be copied out
+	for (const FGameplayTag& RequiredTag : QuestData->RequiredGameplayTags)
+	{
+		if (bAquatic && CanDiveTag.MatchesTag(RequiredTag))
+		{
+			continue;
+		}
+
+		if (!AbilitySystemComponent->HasMatchingGameplayTag(RequiredTag))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void AIQuestManager::PublishQuestEvent(AIBaseCharacter* Character, EQuestEvent Event)
+{
+	if (!Character || !HasAuthority())
+	{
+		return;
+	}
+
+	const FQuestEventMask EventBit = QuestEventBit(Event);
+	PendingQuestEvents.FindOrAdd(Character) |= EventBit;
+
+	// Group quests are only checked from the group leader, so the leader has to see the event as well
+	for (const UIQuest* const ActiveQuest : Character->GetActiveQuests())
+	{
+		AIPlayerGroupActor* const PlayerGroupActor = ActiveQuest ? ActiveQuest->GetPlayerGroupActor() : nullptr;
+		if (!PlayerGroupActor || !PlayerGroupActor->GetGroupLeader())
+		{
+			continue;
+		}
+
+		if (AIBaseCharacter* const GroupLeader = PlayerGroupActor->GetGroupLeader()->GetPawn<AIBaseCharacter>())
+		{
+			if (GroupLeader != Character)
+			{
+				PendingQuestEvents.FindOrAdd(GroupLeader) |= EventBit;
 			}
+		}
+	}
+}
+
+void AIQuestManager::PublishGlobalQuestEvent(EQuestEvent Event)
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	PendingGlobalQuestEvents |= QuestEventBit(Event);
+}
+
+void AIQuestManager::WatchQuestStats(AIBaseCharacter* OwningCharacter, const UIQuest* Quest)
+{
+	for (const UIQuestBaseTask* const QuestTask : Quest->GetQuestTasks())
+	{
+		const UIQuestPersonalStat* const StatTask = Cast<UIQuestPersonalStat>(QuestTask);
+		if (!StatTask || StatTask->IsCompleted())
+		{
+			continue;
+		}
+
+		// Feed member tasks track the stat of the group member being fed
+		const UIQuestFeedMember* const FeedMemberTask = Cast<UIQuestFeedMember>(StatTask);
+		const AIBaseCharacter* const StatOwner = FeedMemberTask ? FeedMemberTask->TargetMember : OwningCharacter;
+		UAbilitySystemComponent* const AbilitySystem = IsValid(StatOwner) ? StatOwner->GetAbilitySystemComponent() : nullptr;
+		if (!AbilitySystem)
+		{
+			continue;
+		}
 
-			// Only process checks for Group Quests if it is from the Group Leader to save performance
-			if (ActiveQuest->GetPlayerGroupActor() && ActiveQuest->GetPlayerGroupActor()->GetGroupLeader() && ActiveQuest->GetPlayerGroupActor()->GetGroupLeader() != PlayerState && !FeedMemberQuestWithTargetLeader) continue;
+		for (const FGameplayAttribute& Attribute : { StatTask->TargetAttributeValue, StatTask->TargetAttributeMax })
+		{
+			if (!Attribute.IsValid())
+			{
+				continue;
+			}
 
-			if (!ActiveQuest->IsCompleted() || FeedMemberQuestWithTargetLeader)
+			FQuestStatWatch& Watch = QuestStatWatches.FindOrAdd(FQuestStatWatchKey{ AbilitySystem, Attribute, OwningCharacter });
+			if (!Watch.Handle.IsValid())
 			{
-				// Check for quest completion
-				ActiveQuest->CheckCompletion();
+				Watch.AbilitySystem = AbilitySystem;
+				Watch.Handle = AbilitySystem->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &AIQuestManager::OnWatchedQuestStatChanged, MakeWeakObjectPtr(OwningCharacter));
+			}
 
-				if (ActiveQuest->IsCompleted())
-				{
-					// save data on feed member quest to cleanup after for loop
-					if (FeedMemberQuestWithTargetLeader)
-					{
-						FeedMemberCleanupGroupActor = ActiveQuest->GetPlayerGroupActor();
-						FeedMemberQuestToCleanup = ActiveQuest;
+			Watch.SweepId = QuestStatSweepId;
+		}
+	}
+}
 
-						FeedMemberCleanupGroupActor->RemoveGroupQuestFailure(FeedMemberQuestToCleanup->GetQuestId(), true);
-					}
+void AIQuestManager::OnWatchedQuestStatChanged(const FOnAttributeChangeData& ChangeData, TWeakObjectPtr<AIBaseCharacter> Subscriber)
+{
+	PublishQuestEvent(Subscriber.Get(), EQuestEvent::StatChanged);
+}
 
-					OnQuestCompleted(OwningCharacter, ActiveQuest);
-					continue;
-				}
+void AIQuestManager::PruneQuestStatWatches()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::PruneQuestStatWatches"))
+
+	// The sweep that just ran refreshed every watch still backed by an unfinished stat task
+	for (auto It = QuestStatWatches.CreateIterator(); It; ++It)
+	{
+		if (It.Value().SweepId == QuestStatSweepId)
+		{
+			continue;
+		}
+
+		if (UAbilitySystemComponent* const AbilitySystem = It.Value().AbilitySystem.Get())
+		{
+			AbilitySystem->GetGameplayAttributeValueChangeDelegate(It.Key().Attribute).Remove(It.Value().Handle);
+		}
+
+		It.RemoveCurrent();
+	}
+}
+
+FString AIQuestManager::BenchmarkQuestDispatch(int32 NumSeconds, AIBaseCharacter* TemplateCharacter)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::BenchmarkQuestDispatch"))
+
+	// Tasks return straight away without an owner, which would only measure the dispatch loop
+	if (!IsValid(TemplateCharacter) || !TemplateCharacter->GetAbilitySystemComponent() || !HasAuthority())
+	{
+		return TEXT("QuestDispatch: needs a spawned character with an ability system to copy the benchmark characters from");
+	}
+
+	UWorld* const World = GetWorld();
+	check(World);
 
-				// Handle timed quests and failure
-				if (QuestData->TimeLimit > 0.0f && (!QuestData->bLeftAreaTimeLimit || ActiveQuest->IsFailureInbound()))
+	NumSeconds = FMath::Max(NumSeconds, 1);
+
+	constexpr int32 NumPlayers = 200;
+	constexpr int32 QuestsPerPlayer = 10;
+	const int32 SweepInterval = FMath::Max(1, CVarQuestFallbackSweepInterval.GetValueOnGameThread());
+
+	// Stand-in characters well below the map, so no connected player's quests are touched
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags |= RF_Transient;
+
+	TArray<AIBaseCharacter*> Characters;
+	TArray<FQuestTickParticipant> Participants;
+	for (int32 Player = 0; Player < NumPlayers; Player++)
+	{
+		const FVector Location(Player * 1000.0f, 0.0f, -1000000.0f);
+		AIBaseCharacter* const Character = World->SpawnActor<AIBaseCharacter>(TemplateCharacter->GetClass(), Location, FRotator::ZeroRotator, SpawnParams);
+		if (!Character || !Character->GetAbilitySystemComponent())
+		{
+			continue;
+		}
+
+		Character->SetActorEnableCollision(false);
+		Characters.Add(Character);
+		Participants.Emplace(nullptr, Character);
+	}
+
+	// Synthetic quests that never complete, so every update runs the full task against the owner's attributes
+	UQuestData* const BenchmarkQuestData = NewObject<UQuestData>(GetTransientPackage());
+
+	for (int32 Player = 0; Player < Characters.Num(); Player++)
+	{
+		for (int32 QuestIndex = 0; QuestIndex < QuestsPerPlayer; QuestIndex++)
+		{
+			UIQuest* const Quest = NewObject<UIQuest>(Characters[Player]);
+			Quest->QuestData = BenchmarkQuestData;
+
+			TArray<UIQuestBaseTask*> Tasks;
+			switch ((Player * QuestsPerPlayer + QuestIndex) % 3)
+			{
+				case 0:
+					Tasks.Add(NewObject<UIQuestPersonalStat>(Quest));
+					Tasks.Add(NewObject<UIQuestPersonalStat>(Quest));
+					break;
+				case 1:
+					Tasks.Add(NewObject<UIQuestExploreTask>(Quest));
+					Tasks.Add(NewObject<UIQuestPersonalStat>(Quest));
+					break;
+				default:
+					Tasks.Add(NewObject<UIQuestExploreTask>(Quest));
+					Tasks.Add(NewObject<UIQuestGenericTask>(Quest));
+					break;
+			}
+
+			for (UIQuestBaseTask* const Task : Tasks)
+			{
+				if (UIQuestPersonalStat* const StatTask = Cast<UIQuestPersonalStat>(Task))
 				{
-					if (ActiveQuest->GetRemainingTime() > 0)
-					{
-						ActiveQuest->SetRemainingTime(ActiveQuest->GetRemainingTime() - 1);
-					}
-					else {
-						ActiveQuest->SetRemainingTime(0);
-						OnQuestFail(OwningCharacter, ActiveQuest);
-					}
+					StatTask->TargetAttributeValue = UCoreAttributeSet::GetHealthAttribute();
+					StatTask->TargetAttributeMax = UCoreAttributeSet::GetMaxHealthAttribute();
+					StatTask->CompletePercentage = 2.0f;
 				}
+
+				Task->SetParentQuest(Quest);
+				Quest->GetQuestTasks_Mutable().Add(Task);
 			}
+
+			Characters[Player]->GetActiveQuests_Mutable().Add(Quest);
 		}
 	}
 
-	//replicate the logic of GroupQuestResult without actually calling GroupQuestResult and completing the quest additional times
-	if (FeedMemberCleanupGroupActor && FeedMemberQuestToCleanup)
+	// Events the real players published before the benchmark are handed back afterwards
+	TMap<TObjectKey<AIBaseCharacter>, FQuestEventMask> SavedQuestEvents = MoveTemp(PendingQuestEvents);
+	PendingQuestEvents.Reset();
+	const FQuestEventMask SavedGlobalQuestEvents = PendingGlobalQuestEvents;
+	PendingGlobalQuestEvents = 0;
+	const int32 SavedQuestTicksSinceSweep = QuestTicksSinceSweep;
+
+	// The benchmark's sweeps would prune the watches of every real player, they aren't participants
+	TMap<FQuestStatWatchKey, FQuestStatWatch> SavedQuestStatWatches = MoveTemp(QuestStatWatches);
+	QuestStatWatches.Reset();
+
+	// Every quest refreshed every tick, what QuestTick did before events were published
+	const double PollingStart = FPlatformTime::Seconds();
+	for (int32 Second = 0; Second < NumSeconds; Second++)
 	{
-		FeedMemberCleanupGroupActor->RemoveGroupQuest(FeedMemberQuestToCleanup);
+		for (AIBaseCharacter* const Character : Characters)
+		{
+			PublishQuestEvent(Character, EQuestEvent::Refresh);
+		}
 
-		FeedMemberCleanupGroupActor->AssignGroupQuests();
+		TickQuests(Participants);
+	}
+	const double PollingSeconds = FPlatformTime::Seconds() - PollingStart;
+
+	// Players publish a mix of events, quests only update for the ones they subscribe to plus the fallback sweep
+	FRandomStream RandomStream(NumPlayers);
+	QuestTicksSinceSweep = 0;
+	const double EventStart = FPlatformTime::Seconds();
+	for (int32 Second = 0; Second < NumSeconds; Second++)
+	{
+		for (AIBaseCharacter* const Character : Characters)
+		{
+			if (RandomStream.FRand() < 0.2f) PublishQuestEvent(Character, EQuestEvent::StatChanged);
+			if (RandomStream.FRand() < 0.05f) PublishQuestEvent(Character, EQuestEvent::Kill);
+			if (RandomStream.FRand() < 0.05f) PublishQuestEvent(Character, EQuestEvent::ItemCollected);
+			if (RandomStream.FRand() < 0.02f) PublishQuestEvent(Character, EQuestEvent::LocationDiscovered);
+		}
+
+		TickQuests(Participants);
+	}
+	const double EventSeconds = FPlatformTime::Seconds() - EventStart;
+
+	PendingQuestEvents = MoveTemp(SavedQuestEvents);
+	PendingGlobalQuestEvents = SavedGlobalQuestEvents;
+	QuestTicksSinceSweep = SavedQuestTicksSinceSweep;
+
+	// Every watch left belongs to a stand-in
+	for (const TPair<FQuestStatWatchKey, FQuestStatWatch>& Pair : QuestStatWatches)
+	{
+		if (UAbilitySystemComponent* const AbilitySystem = Pair.Value.AbilitySystem.Get())
+		{
+			AbilitySystem->GetGameplayAttributeValueChangeDelegate(Pair.Key.Attribute).Remove(Pair.Value.Handle);
+		}
+	}
+
+	QuestStatWatches = MoveTemp(SavedQuestStatWatches);
+
+	for (AIBaseCharacter* const Character : Characters)
+	{
+		KillTaskIndices.Remove(Character);
+		Character->GetActiveQuests_Mutable().Reset();
+		Character->Destroy();
 	}
+
+	const FString Summary = FString::Printf(TEXT("QuestDispatch: %d characters x %d quests, %d quest ticks, sweep every %d. Polling: %.3fms (%.3fms/tick) EventBus: %.3fms (%.3fms/tick)"),
+		Characters.Num(), QuestsPerPlayer, NumSeconds, SweepInterval, PollingSeconds * 1000.0, PollingSeconds * 1000.0 / NumSeconds, EventSeconds * 1000.0, EventSeconds * 1000.0 / NumSeconds);
+
+	UE_LOG(TitansQuests, Log, TEXT("AIQuestManager::BenchmarkQuestDispatch: %s"), *Summary);
+
+	return Summary;
 }
 
 // Called once a minute on authority only
@@ -496,6 +855,29 @@ void AIQuestManager::OnQuestTock(AIBaseCharacter* OwningCharacter, FPrimaryAsset
 	}
 }
 
+// Pops every expiry that is due and removes the entries it stamped, returns true if any entry was removed
+template<typename EntryType>
+static bool RemoveDueQuestEntries(TArray<FQuestExpiry>& Expiries, TArray<EntryType>& Entries, float CleanupDelay, float TimeSeconds)
+{
+	bool bRemovedAny = false;
+
+	while (!Expiries.IsEmpty() && Expiries.HeapTop().Timestamp + CleanupDelay <= TimeSeconds)
+	{
+		FQuestExpiry Expiry;
+		Expiries.HeapPop(Expiry, false);
+
+		const bool bAnyCharacter = Expiry.CharacterID == FAlderonUID(-1);
+
+		// Entries restamped since were pushed again and wait for their own expiry
+		bRemovedAny |= Entries.RemoveAll([&Expiry, bAnyCharacter](const EntryType& Entry)
+		{
+			return Entry.Timestamp == Expiry.Timestamp && Entry.QuestId == Expiry.QuestId && (bAnyCharacter || Entry.CharacterID == Expiry.CharacterID);
+		}) > 0;
+	}
+
+	return bRemovedAny;
+}
+
 void AIQuestManager::ContributionTick()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::ContributionTick"))
@@ -508,29 +890,31 @@ void AIQuestManager::ContributionTick()
 
 	const float CleanupDelay = (UE_BUILD_SHIPPING) ? QuestContributionCleanupDelay : 60.0f;
 	const float TimeSeconds = GetWorld()->TimeSeconds;
-	
-	bool bNeedsDirtying = false;
-		
-	for (int32 Index = GetQuestContributions().Num() - 1; Index >= 0; --Index)
-	{
-		const FQuestContribution& QuestContribution = GetQuestContributions()[Index];
-
-		if (QuestContribution.Timestamp == 0.0f) continue;
-
-		// Only keep contributions for 10 minutes after they have been rewarded to allow for them to log back into their character
-		if ((QuestContribution.Timestamp + CleanupDelay) <= TimeSeconds)
-		{
-			QuestContributions.RemoveAt(Index);
-			bNeedsDirtying = true;
-		}
-	}
 
-	if (bNeedsDirtying)
+	// Only keep contributions for 10 minutes after they have been rewarded to allow for them to log back into their character
+	if (RemoveDueQuestEntries(ContributionExpiries, QuestContributions, CleanupDelay, TimeSeconds))
 	{
 		MARK_PROPERTY_DIRTY_FROM_NAME(AIQuestManager, QuestContributions, this);
 	}
 }
 
+void AIQuestManager::TrackContributionExpiry(const FPrimaryAssetId& QuestId, float Timestamp)
+{
+	ContributionExpiries.HeapPush(FQuestExpiry(Timestamp, QuestId));
+}
+
+void AIQuestManager::AddGroupMeetQuestCooldown(const FQuestCooldown& Cooldown)
+{
+	GroupMeetQuestCooldowns.Add(Cooldown);
+	GroupMeetCooldownExpiries.HeapPush(FQuestExpiry(Cooldown.Timestamp, Cooldown.QuestId, Cooldown.CharacterID));
+}
+
+void AIQuestManager::AddTrophyQuestCooldown(const FQuestCooldown& Cooldown)
+{
+	GetTrophyQuestsOnCooldown_Mutable().Add(Cooldown);
+	TrophyCooldownExpiries.HeapPush(FQuestExpiry(Cooldown.Timestamp, Cooldown.QuestId, Cooldown.CharacterID));
+}
+
 void AIQuestManager::CooldownTick()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::CooldownTick"))
@@ -539,57 +923,23 @@ void AIQuestManager::CooldownTick()
 
 	float CleanupDelay = (UE_BUILD_SHIPPING) ? LocalQuestCooldownDelay : 60.0f;
 	float TimeSeconds = GetWorld()->TimeSeconds;
-	int64 NowTimestamp = FDateTime::UtcNow().ToUnixTimestamp();
 
-	TArray<FQuestCooldown> LocalCooldownWorldQuests = GetLocalWorldQuestsOnCooldown();
-
-	if (!LocalCooldownWorldQuests.IsEmpty() && CleanupDelay > 0.0f)
+	if (CleanupDelay > 0.0f)
 	{
-		for (int32 i = LocalCooldownWorldQuests.Num(); i-- > 0;)
-		{
-			const FQuestCooldown& LocalQuestCooldown = LocalCooldownWorldQuests[i];
-
-			// Only keep contributions for 10 minutes after they have been rewarded to allow for them to log back into their character
-			if (LocalQuestCooldown.IsExpired(NowTimestamp, CleanupDelay))
-			{
-				//UE_LOG(TitansLog, Log, TEXT("AIQuestManager::CooldownTick(): Expired! Removing"));
-				RemoveLocalWorldQuestCooldown(LocalQuestCooldown);
-			}
-			//else
-			//{
-				//FTimespan TimeRemaining = (FDateTime::FromUnixTimestamp(LocalQuestCooldown.UnixTimestamp) + FTimespan(0, 0, CleanupDelay)) - FDateTime::UtcNow();
-				//UE_LOG(TitansLog, Log, TEXT("AIQuestManager::CooldownTick(): Not Expired! Remaining time %i:%i:%i"), TimeRemaining.GetHours(), TimeRemaining.GetMinutes(), TimeRemaining.GetSeconds());
-			//}
-		}
+		// Only keep contributions for 10 minutes after they have been rewarded to allow for them to log back into their character
+		PruneLocalWorldQuestCooldowns();
 	}
 
 	CleanupDelay = (UE_BUILD_SHIPPING) ? GroupMeetQuestCooldownDelay : 60.0f;
-	if (!GroupMeetQuestCooldowns.IsEmpty() && CleanupDelay > 0.0f)
+	if (CleanupDelay > 0.0f)
 	{
-		for (int32 i = GroupMeetQuestCooldowns.Num(); i-- > 0;)
-		{
-			FQuestCooldown GroupMeetQuestCooldown = GroupMeetQuestCooldowns[i];
-
-			// Only keep contributions for 10 minutes after they have been rewarded to allow for them to log back into their character
-			if ((GroupMeetQuestCooldown.Timestamp + CleanupDelay) <= TimeSeconds)
-			{
-				GroupMeetQuestCooldowns.RemoveAt(i);
-			}
-		}
+		RemoveDueQuestEntries(GroupMeetCooldownExpiries, GroupMeetQuestCooldowns, CleanupDelay, TimeSeconds);
 	}
 
 	CleanupDelay = (UE_BUILD_SHIPPING) ? GroupQuestCleanupDelay : 60.0f;
-	if (!GroupQuestsOnCooldown.IsEmpty() && CleanupDelay > 0.0f)
+	if (CleanupDelay > 0.0f)
 	{
-		for (int32 i = GroupQuestsOnCooldown.Num(); i-- > 0;)
-		{
-			FQuestCooldown& GroupQuestCooldown = GroupQuestsOnCooldown[i];
-
-			if ((GroupQuestCooldown.Timestamp + CleanupDelay) <= TimeSeconds)
-			{
-				GroupQuestsOnCooldown.RemoveAt(i);
-			}
-		}
+		RemoveDueQuestEntries(GroupQuestCooldownExpiries, GroupQuestsOnCooldown, CleanupDelay, TimeSeconds);
 	}
 
 	CleanupDelay = (UE_BUILD_SHIPPING) ? LocationCompletedCleanupDelay : 60.0f;
@@ -597,8 +947,7 @@ void AIQuestManager::CooldownTick()
 	AIGameState* IGameState = UIGameplayStatics::GetIGameState(this);
 	check(IGameState);
 
-	TArray<APlayerState*> PlayerArray = IGameState->PlayerArray;
-	for (APlayerState* PlayerState : PlayerArray)
+	for (APlayerState* PlayerState : IGameState->PlayerArray)
 	{
 		AIPlayerState* IPS = Cast<AIPlayerState>(PlayerState);
 		if (!IsValid(IPS)) continue;
@@ -645,25 +994,9 @@ void AIQuestManager::CooldownTick()
 	
 	CleanupDelay = (UE_BUILD_SHIPPING) ? TrophyQuestCooldownDelay : 60.0f;
 	
-	if (CleanupDelay > 0.0f)
+	if (CleanupDelay > 0.0f && RemoveDueQuestEntries(TrophyCooldownExpiries, TrophyQuestsOnCooldown, CleanupDelay, TimeSeconds))
 	{
-		bool bNeedsDirtying = false;
-
-		for (int32 Index = GetTrophyQuestsOnCooldown().Num() - 1; Index >= 0; --Index)
-		{
-			const FQuestCooldown& QuestCooldown = GetTrophyQuestsOnCooldown()[Index];
-
-			if (QuestCooldown.Timestamp + CleanupDelay <= TimeSeconds)
-			{
-				TrophyQuestsOnCooldown.RemoveAt(Index);
-				bNeedsDirtying = true;
-			}
-		}
-
-		if (bNeedsDirtying)
-		{
-			MARK_PROPERTY_DIRTY_FROM_NAME(AIQuestManager, TrophyQuestsOnCooldown, this);
-		}
+		MARK_PROPERTY_DIRTY_FROM_NAME(AIQuestManager, TrophyQuestsOnCooldown, this);
 	}
 }
 
@@ -773,6 +1106,13 @@ void AIQuestManager::GetRandomQuest(AIBaseCharacter* Character, FQuestIDLoaded Q
 			}
 		}
 	}
+
+	// Draw from the cached pools once they are built instead of going through the asset manager
+	if (DrawRandomQuestFromPool(QuestFilter, Character, PreferredType, ActivePersonalQuestType, QuestIDLoaded))
+	{
+		return;
+	}
+
 	FQuestsIDsLoaded LoadAssetIDsDelegate;
 	TWeakObjectPtr<AIQuestManager> WeakThis = MakeWeakObjectPtr(this);
 	TWeakObjectPtr<AIBaseCharacter> WeakCharacter = MakeWeakObjectPtr(Character);
@@ -835,15 +1175,8 @@ void AIQuestManager::OnGetRandomQuest(AIBaseCharacter* Character, EQuestShareTyp
 	// Because of the Async nature of quest loading we need to re-check this, or else we can end up with multiple quests beyond the limit.
 	if (!HasRoomForQuest(Character, PreferredType, ActivePersonalQuestType)) return;
 
-	UIGameInstance* GI = Cast<UIGameInstance>(GetGameInstance());
-	check(GI);
-
-	AIGameSession* Session = Cast<AIGameSession>(GI->GetGameSession());
-	check(Session);
-
-	AIGameState* IGameState = UIGameplayStatics::GetIGameState(this);
-	check(IGameState);
-	if (!IGameState)
+	FRandomQuestDraw Draw;
+	if (!BeginRandomQuestDraw(Character, Draw))
 	{
 		return;
 	}
@@ -859,19 +1192,6 @@ void AIQuestManager::OnGetRandomQuest(AIBaseCharacter* Character, EQuestShareTyp
 	bool bMoreThanOneQuest = Quests.Num() > 1;
 	bool bLimitType = (PreferredType != EQuestShareType::Unknown);
 
-	FPrimaryAssetId ClosestPOIQuest;
-	int32 ClosestPOIDistance = 99999999;
-	FVector CharacterLocation = Character->GetActorLocation();
-
-	if (AIPlayerCaveBase* IPlayerCave = Character->GetCurrentInstance())
-	{
-		FInstanceLogoutSaveableInfo* InstanceLogoutSaveableInfo = Character->GetInstanceLogoutInfo(UGameplayStatics::GetCurrentLevelName(this));
-		if (InstanceLogoutSaveableInfo)
-		{
-			CharacterLocation = InstanceLogoutSaveableInfo->CaveReturnLocation;
-		}
-	}
-
 	int32 NumAttempts = 0;
 	const int32 MaxAttempts = Quests.Num();
 	const int32 RandomStartingQuestIndex = FMath::RandRange(0, (MaxAttempts - 1));
@@ -910,9 +1230,9 @@ void AIQuestManager::OnGetRandomQuest(AIBaseCharacter* Character, EQuestShareTyp
 			if (!SelectedQuest.IsValid() && PreferredType == EQuestShareType::Personal)
 			{
 				// GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Red, FString::Printf(TEXT("!SelectedQuest.IsValid() && PreferredType == EQuestShareType::Personal")));
-				if (ClosestPOIQuest.IsValid())
+				if (Draw.ClosestPOIQuest.IsValid())
 				{
-					QuestIDLoaded.ExecuteIfBound(ClosestPOIQuest);
+					QuestIDLoaded.ExecuteIfBound(Draw.ClosestPOIQuest);
 				}
 				return;
 			}
@@ -926,317 +1246,355 @@ void AIQuestManager::OnGetRandomQuest(AIBaseCharacter* Character, EQuestShareTyp
 
 		NumAttempts++;
 
-		// Ensure the quest is valid
-		if (!RandomQuestSelection.IsValid()) continue;
+		if (!IsRandomQuestEligible(Character, PreferredType, ActivePersonalQuestType, RandomQuestSelection, nullptr, Draw)) continue;
 
-		// Ensure we are not giving the player a quest they already have
-		bool bQuestIsDuplicateId = false;
+		// If we got this far we got a valid quest so return it
+		SelectedQuest = RandomQuestSelection;
 
-		for (UIQuest* Quest : Character->GetActiveQuests())
-		{
-			if (!Quest) continue;
+		GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Green, FString::Printf(TEXT("AIQuestManager::GetRandomQuest - SelectedQuest: %s"), *SelectedQuest.ToString()));
+		QuestIDLoaded.ExecuteIfBound(SelectedQuest);
+		return;
+	}
 
-			if (RandomQuestSelection == Quest->GetQuestId())
-			{
-				// Skip assigning a random quest as we already have one of this type
-				bQuestIsDuplicateId = true;
-				break;
-			}
+	QuestIDLoaded.ExecuteIfBound(SelectedQuest);
+	return;
+}
+
+bool AIQuestManager::BeginRandomQuestDraw(AIBaseCharacter* Character, FRandomQuestDraw& OutDraw)
+{
+	UIGameInstance* GI = Cast<UIGameInstance>(GetGameInstance());
+	check(GI);
+
+	OutDraw.Session = Cast<AIGameSession>(GI->GetGameSession());
+	check(OutDraw.Session);
+
+	OutDraw.IGameState = UIGameplayStatics::GetIGameState(this);
+	check(OutDraw.IGameState);
+	if (!OutDraw.IGameState)
+	{
+		return false;
+	}
+
+	OutDraw.CharacterLocation = Character->GetActorLocation();
+
+	if (AIPlayerCaveBase* IPlayerCave = Character->GetCurrentInstance())
+	{
+		FInstanceLogoutSaveableInfo* InstanceLogoutSaveableInfo = Character->GetInstanceLogoutInfo(UGameplayStatics::GetCurrentLevelName(this));
+		if (InstanceLogoutSaveableInfo)
+		{
+			OutDraw.CharacterLocation = InstanceLogoutSaveableInfo->CaveReturnLocation;
 		}
+	}
 
-		if (bQuestIsDuplicateId) continue;
+	return true;
+}
 
-		// Load Quest Data for more complicated quest type picking
-		UQuestData* QuestData = LoadQuestData(RandomQuestSelection);
-		if (!QuestData || !QuestData->bEnabled) continue;
-		check(QuestData);
+bool AIQuestManager::IsRandomQuestEligible(AIBaseCharacter* Character, EQuestShareType PreferredType, EQuestType ActivePersonalQuestType, const FPrimaryAssetId& RandomQuestSelection, UQuestData* QuestData, FRandomQuestDraw& Draw)
+{
+	// Ensure the quest is valid
+	if (!RandomQuestSelection.IsValid()) return false;
 
-		if (ActivePersonalQuestType != EQuestType::MAX && ActivePersonalQuestType == QuestData->QuestType) continue;
+	// Ensure we are not giving the player a quest they already have
+	bool bQuestIsDuplicateId = false;
 
-		// Skip picking this quest if it is the same type as the one we just completed
-		// allow duplicate types of survival however
-		//if (!bAllowRepeatQuestTypes && QuestData->QuestShareType != EQuestShareType::Survival)
-		//{
-		//	if (QuestData->QuestType == GetLastQuestType(Character, nullptr, false)) continue;
-		//}
+	for (UIQuest* Quest : Character->GetActiveQuests())
+	{
+		if (!Quest) continue;
 
-		if (UIGameplayStatics::IsGrowthEnabled(this) && Character->GetGrowthPercent() < QuestData->GrowthRequirement)
+		if (RandomQuestSelection == Quest->GetQuestId())
 		{
-			continue;
+			// Skip assigning a random quest as we already have one of this type
+			bQuestIsDuplicateId = true;
+			break;
 		}
+	}
 
-		// If we have a quest tag setup on this character then skip if the tag isn't the same. Otherwise continue.
-		bool bHasQuestTag = true;
-		if (!Character->QuestTags.IsEmpty() && QuestData->QuestTag != NAME_QuestTagNone)
+	if (bQuestIsDuplicateId) return false;
+
+	// Load Quest Data for more complicated quest type picking, the cached pools already hold it
+	if (!QuestData)
+	{
+		QuestData = LoadQuestData(RandomQuestSelection);
+	}
+	if (!QuestData || !QuestData->bEnabled) return false;
+
+	if (ActivePersonalQuestType != EQuestType::MAX && ActivePersonalQuestType == QuestData->QuestType) return false;
+
+	// Skip picking this quest if it is the same type as the one we just completed
+	// allow duplicate types of survival however
+	//if (!bAllowRepeatQuestTypes && QuestData->QuestShareType != EQuestShareType::Survival)
+	//{
+	//	if (QuestData->QuestType == GetLastQuestType(Character, nullptr, false)) continue;
+	//}
+
+	if (UIGameplayStatics::IsGrowthEnabled(this) && Character->GetGrowthPercent() < QuestData->GrowthRequirement)
+	{
+		return false;
+	}
+
+	// If we have a quest tag setup on this character then skip if the tag isn't the same. Otherwise continue.
+	bool bHasQuestTag = true;
+	if (!Character->QuestTags.IsEmpty() && QuestData->QuestTag != NAME_QuestTagNone)
+	{
+		bHasQuestTag = false;
+		for (int32 i = 0; i < Character->QuestTags.Num(); i++)
 		{
-			bHasQuestTag = false;
-			for (int32 i = 0; i < Character->QuestTags.Num(); i++)
+			if (QuestData->QuestTag == Character->QuestTags[i])
 			{
-				if (QuestData->QuestTag == Character->QuestTags[i])
-				{
-					bHasQuestTag = true;
-					break;
-				}
+				bHasQuestTag = true;
+				break;
 			}
 		}
-		if (!bHasQuestTag) continue;
+	}
+	if (!bHasQuestTag) return false;
 
-		if (!QuestData->RequiredGameplayTags.IsEmpty())
+	if (!QuestData->RequiredGameplayTags.IsEmpty())
+	{
+		FGameplayTagContainer CharacterTags{};
+		if (UAbilitySystemComponent* AbilitySystemComponent = Character->GetAbilitySystemComponent())
 		{
-			FGameplayTagContainer CharacterTags{};
-			if (UAbilitySystemComponent* AbilitySystemComponent = Character->GetAbilitySystemComponent())
+			AbilitySystemComponent->GetOwnedGameplayTags(CharacterTags);
+			// certain quests should only be give to characters that can dive
+			// Ability.CanDive simply causes bAquatic to be set to true, but dinos with bAquatic == true do not necessarily have the CanDive tag
+			// if Character->IsAquatic() == true then the character can dive, this code block allows bp data assets to rely on Ability.CanDive as a required tag
+			if (Character->IsAquatic())
 			{
-				AbilitySystemComponent->GetOwnedGameplayTags(CharacterTags);
-				// certain quests should only be give to characters that can dive
-				// Ability.CanDive simply causes bAquatic to be set to true, but dinos with bAquatic == true do not necessarily have the CanDive tag
-				// if Character->IsAquatic() == true then the character can dive, this code block allows bp data assets to rely on Ability.CanDive as a required tag
-				if (Character->IsAquatic())
-				{
-					CharacterTags.AddTag(UPOTAbilitySystemGlobals::Get().CanDiveTag);
-				}
+				CharacterTags.AddTag(UPOTAbilitySystemGlobals::Get().CanDiveTag);
 			}
+		}
 
-			if (!CharacterTags.HasAll(QuestData->RequiredGameplayTags))
-			{
-				continue;
-			}
+		if (!CharacterTags.HasAll(QuestData->RequiredGameplayTags))
+		{
+			return false;
 		}
+	}
 
-		if (QuestData->QuestType == EQuestType::Exploration)
+	if (QuestData->QuestType == EQuestType::Exploration)
+	{
+		const FTimespan TimeSinceLastCompletedExplorationQuest = (FDateTime::UtcNow() - Character->LastCompletedExplorationQuestTime);
+		if (TimeSinceLastCompletedExplorationQuest.GetMinutes() < Draw.Session->ServerMinTimeBetweenExplorationQuest)
 		{
-			const FTimespan TimeSinceLastCompletedExplorationQuest = (FDateTime::UtcNow() - Character->LastCompletedExplorationQuestTime);
-			if (TimeSinceLastCompletedExplorationQuest.GetMinutes() < Session->ServerMinTimeBetweenExplorationQuest)
-			{
-				continue;
-			}
+			return false;
+		}
 
-			// Don't give a location you are already inside
-			if (!QuestData->QuestTasks.IsEmpty())
-			{
-				bool bSkipLocationAlreadyInside = false;
-				bool bFoundLocation = false;
+		// Don't give a location you are already inside
+		if (!QuestData->QuestTasks.IsEmpty())
+		{
+			bool bSkipLocationAlreadyInside = false;
+			bool bFoundLocation = false;
 
-				for (TSoftClassPtr<UIQuestBaseTask>& QuestSoftPtr : QuestData->QuestTasks)
+			for (TSoftClassPtr<UIQuestBaseTask>& QuestSoftPtr : QuestData->QuestTasks)
+			{
+				QuestSoftPtr.LoadSynchronous();
+				if (UClass* QuestBaseTaskClass = QuestSoftPtr.Get())
 				{
-					QuestSoftPtr.LoadSynchronous();
-					if (UClass* QuestBaseTaskClass = QuestSoftPtr.Get())
+					UIQuestExploreTask* ExploreTaskClass = NewObject<UIQuestExploreTask>(Character, QuestBaseTaskClass);
+					if (ExploreTaskClass)
 					{
-						UIQuestExploreTask* ExploreTaskClass = NewObject<UIQuestExploreTask>(Character, QuestBaseTaskClass);
-						if (ExploreTaskClass)
+						if (ExploreTaskClass->bSkipIfAlreadyInside)
 						{
-							if (ExploreTaskClass->bSkipIfAlreadyInside)
+							if (Character->LastLocationEntered && Character->LastLocationTag != NAME_None && ExploreTaskClass->Tag == Character->LastLocationTag)
 							{
-								if (Character->LastLocationEntered && Character->LastLocationTag != NAME_None && ExploreTaskClass->Tag == Character->LastLocationTag)
-								{
-									bSkipLocationAlreadyInside = true;
-									break;
-								}
+								bSkipLocationAlreadyInside = true;
+								break;
 							}
+						}
 
-							// Try to find a location within range, as a last resort we will just find the closest POI we aren't in at the top of this functions while loop
-							for (AActor* POI : AllPointsOfInterest)
+						// Try to find a location within range, as a last resort we will just find the closest POI we aren't in at the top of this functions while loop
+						for (AActor* POI : AllPointsOfInterest)
+						{
+							if (!IsPoiCompatibleForExploration(POI, Character))
 							{
-								if (!IsPoiCompatibleForExploration(POI, Character))
-								{
-									//UE_LOG(TitansLog, Log, TEXT("AIQuestManager::GetRandomQuest: Skipping Exploration quest assign (%s) due to incompatible quest tags."), *QuestData->GetDisplayName().ToString());
-									continue;
-								}
+								//UE_LOG(TitansLog, Log, TEXT("AIQuestManager::GetRandomQuest: Skipping Exploration quest assign (%s) due to incompatible quest tags."), *QuestData->GetDisplayName().ToString());
+								continue;
+							}
 
-								AIPointOfInterest* SpherePOI = Cast<AIPointOfInterest>(POI);
-								AIPOI* MeshPOI = Cast<AIPOI>(POI);
+							AIPointOfInterest* SpherePOI = Cast<AIPointOfInterest>(POI);
+							AIPOI* MeshPOI = Cast<AIPOI>(POI);
 
-								if ((MeshPOI && MeshPOI->GetLocationTag() == ExploreTaskClass->Tag) || (SpherePOI && SpherePOI->GetLocationTag() == ExploreTaskClass->Tag))
+							if ((MeshPOI && MeshPOI->GetLocationTag() == ExploreTaskClass->Tag) || (SpherePOI && SpherePOI->GetLocationTag() == ExploreTaskClass->Tag))
+							{
+								if (AIWorldSettings* IWorldSettings = Cast<AIWorldSettings>(GetWorldSettings()))
 								{
-									if (AIWorldSettings* IWorldSettings = Cast<AIWorldSettings>(GetWorldSettings()))
-									{
-										const FVector POILocation = POI->GetActorLocation();
-
-										//FName POIName;
-										//if (MeshPOI)
-										//{
-										//	POIName = MeshPOI->GetLocationTag();
-										//}
-										//
-										//if (SpherePOI)
-										//{
-										//	POIName = SpherePOI->GetLocationTag();
-										//}
-
-										if (!IWorldSettings->IsInWorldBounds(POILocation))
-										{
-											//GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, FString::Printf(TEXT("AIQuestManager::GetRandomQuest - POI OutOfBounds: %s"), *POIName.ToString()));
-											break;
-										}
-										else if ((MeshPOI && MeshPOI->IsDisabled()) || (SpherePOI && SpherePOI->IsDisabled()))
-										{
-											//GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Green, FString::Printf(TEXT("AIQuestManager::GetRandomQuest - POI Disabled: %s"), *POIName.ToString()));
-											break;
-										}
+									const FVector POILocation = POI->GetActorLocation();
 
-										bFoundLocation = true;
-										//GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Green, FString::Printf(TEXT("AIQuestManager::GetRandomQuest - POI Closest: %s"), *POIName.ToString()));
-										int32 POIDistance = (POILocation - CharacterLocation).Size();
-										ClosestPOIDistance = POIDistance;
-										ClosestPOIQuest = RandomQuestSelection;
+									//FName POIName;
+									//if (MeshPOI)
+									//{
+									//	POIName = MeshPOI->GetLocationTag();
+									//}
+									//
+									//if (SpherePOI)
+									//{
+									//	POIName = SpherePOI->GetLocationTag();
+									//}
+
+									if (!IWorldSettings->IsInWorldBounds(POILocation))
+									{
+										//GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, FString::Printf(TEXT("AIQuestManager::GetRandomQuest - POI OutOfBounds: %s"), *POIName.ToString()));
+										break;
+									}
+									else if ((MeshPOI && MeshPOI->IsDisabled()) || (SpherePOI && SpherePOI->IsDisabled()))
+									{
+										//GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Green, FString::Printf(TEXT("AIQuestManager::GetRandomQuest - POI Disabled: %s"), *POIName.ToString()));
 										break;
 									}
+
+									bFoundLocation = true;
+									//GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Green, FString::Printf(TEXT("AIQuestManager::GetRandomQuest - POI Closest: %s"), *POIName.ToString()));
+									int32 POIDistance = (POILocation - Draw.CharacterLocation).Size();
+									Draw.ClosestPOIDistance = POIDistance;
+									Draw.ClosestPOIQuest = RandomQuestSelection;
+									break;
 								}
 							}
 						}
 					}
 				}
+			}
 
-				if (!bFoundLocation)
-				{
-					//GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Yellow, FString::Printf(TEXT("AIQuestManager::GetRandomQuest - Location Not Found")));
-				}
-
-				if (bSkipLocationAlreadyInside || ClosestPOIDistance > 200000 || !bFoundLocation) continue;
+			if (!bFoundLocation)
+			{
+				//GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Yellow, FString::Printf(TEXT("AIQuestManager::GetRandomQuest - Location Not Found")));
 			}
+
+			if (bSkipLocationAlreadyInside || Draw.ClosestPOIDistance > 200000 || !bFoundLocation) return false;
 		}
+	}
 
-		// Make sure survival stat quests meet requirements
-		if (QuestData->QuestShareType == EQuestShareType::Survival)
-		{
-			bool bSkipIfDoesntMeetRequirements = false;
+	// Make sure survival stat quests meet requirements
+	if (QuestData->QuestShareType == EQuestShareType::Survival)
+	{
+		bool bSkipIfDoesntMeetRequirements = false;
 
-			for (TSoftClassPtr<UIQuestBaseTask>& QuestSoftPtr : QuestData->QuestTasks)
+		for (TSoftClassPtr<UIQuestBaseTask>& QuestSoftPtr : QuestData->QuestTasks)
+		{
+			QuestSoftPtr.LoadSynchronous();
+			if (UClass* QuestBaseTaskClass = QuestSoftPtr.Get())
 			{
-				QuestSoftPtr.LoadSynchronous();
-				if (UClass* QuestBaseTaskClass = QuestSoftPtr.Get())
+				if (!QuestBaseTaskClass->IsChildOf(UIQuestPersonalStat::StaticClass()))
 				{
-					if (!QuestBaseTaskClass->IsChildOf(UIQuestPersonalStat::StaticClass()))
-					{
-						UE_LOG(TitansLog, Warning, TEXT("AIQuestManager::GetRandomQuest: Quest Task %s is not a child of UIQuestPersonalStat!"), *QuestBaseTaskClass->GetDefaultObjectName().ToString());
-						continue;
-					}
+					UE_LOG(TitansLog, Warning, TEXT("AIQuestManager::GetRandomQuest: Quest Task %s is not a child of UIQuestPersonalStat!"), *QuestBaseTaskClass->GetDefaultObjectName().ToString());
+					continue;
+				}
 
-					UIQuestPersonalStat* StatTaskClass = NewObject<UIQuestPersonalStat>(Character, QuestBaseTaskClass);
-					if (StatTaskClass)
-					{
-						bool bMeetsRequirements = StatTaskClass->MeetsStartRequirements(Character);
+				UIQuestPersonalStat* StatTaskClass = NewObject<UIQuestPersonalStat>(Character, QuestBaseTaskClass);
+				if (StatTaskClass)
+				{
+					bool bMeetsRequirements = StatTaskClass->MeetsStartRequirements(Character);
 
-						if (!bMeetsRequirements)
-						{
-							bSkipIfDoesntMeetRequirements = true;
-							break;
-						}
+					if (!bMeetsRequirements)
+					{
+						bSkipIfDoesntMeetRequirements = true;
+						break;
 					}
 				}
 			}
-
-			if (bSkipIfDoesntMeetRequirements) continue;
 		}
-		else if (QuestData->QuestType == EQuestType::Hunting)
-		{
-			bool bMeetsRequirement = false;
 
-			TArray<FPrimaryAssetId> CharacterAssedIds;
-			TArray<AIBaseCharacter*> Characters;
-			for (APlayerState* PlayerState : IGameState->PlayerArray)
-			{
-				AIPlayerState* RemotePlayerState = Cast<AIPlayerState>(PlayerState);
-				if (!RemotePlayerState || !RemotePlayerState->GetCharacterAssetId().IsValid()) continue;
+		if (bSkipIfDoesntMeetRequirements) return false;
+	}
+	else if (QuestData->QuestType == EQuestType::Hunting)
+	{
+		bool bMeetsRequirement = false;
 
-				AIBaseCharacter* RemotePawn = Cast<AIBaseCharacter>(RemotePlayerState->GetPawn());
-				if (!RemotePawn) continue;
+		TArray<FPrimaryAssetId> CharacterAssedIds;
+		TArray<AIBaseCharacter*> Characters;
+		for (APlayerState* PlayerState : Draw.IGameState->PlayerArray)
+		{
+			AIPlayerState* RemotePlayerState = Cast<AIPlayerState>(PlayerState);
+			if (!RemotePlayerState || !RemotePlayerState->GetCharacterAssetId().IsValid()) continue;
 
-				CharacterAssedIds.AddUnique(RemotePawn->CharacterDataAssetId);
-				Characters.Add(RemotePawn);
-			}
+			AIBaseCharacter* RemotePawn = Cast<AIBaseCharacter>(RemotePlayerState->GetPawn());
+			if (!RemotePawn) continue;
 
-			for (TSoftClassPtr<UIQuestBaseTask>& QuestSoftPtr : QuestData->QuestTasks)
+			CharacterAssedIds.AddUnique(RemotePawn->CharacterDataAssetId);
+			Characters.Add(RemotePawn);
+		}
+
+		for (TSoftClassPtr<UIQuestBaseTask>& QuestSoftPtr : QuestData->QuestTasks)
+		{
+			QuestSoftPtr.LoadSynchronous();
+			if (UClass* QuestBaseTaskClass = QuestSoftPtr.Get())
 			{
-				QuestSoftPtr.LoadSynchronous();
-				if (UClass* QuestBaseTaskClass = QuestSoftPtr.Get())
-				{
-					UIQuestKillTask* KillTaskClass = NewObject<UIQuestKillTask>(Character, QuestBaseTaskClass);
-					if (!KillTaskClass) continue;
+				UIQuestKillTask* KillTaskClass = NewObject<UIQuestKillTask>(Character, QuestBaseTaskClass);
+				if (!KillTaskClass) continue;
 
-					if (const UIQuestFishTask* const FishTaskClass = Cast<UIQuestFishTask>(KillTaskClass))
-					{
-						bMeetsRequirement = FishTaskClass->GetFishSize() <= Character->GetMaxCarriableSize();
-						break;
-					}
+				if (const UIQuestFishTask* const FishTaskClass = Cast<UIQuestFishTask>(KillTaskClass))
+				{
+					bMeetsRequirement = FishTaskClass->GetFishSize() <= Character->GetMaxCarriableSize();
+					break;
+				}
 
-					if (KillTaskClass->bIsCritter)
-					{
-						bMeetsRequirement = IGameState->GetGameStateFlags().bCritters;
-						break;
-					}
+				if (KillTaskClass->bIsCritter)
+				{
+					bMeetsRequirement = Draw.IGameState->GetGameStateFlags().bCritters;
+					break;
+				}
 
-					if (!CharacterAssedIds.IsEmpty())
+				if (!CharacterAssedIds.IsEmpty())
+				{
+					if (KillTaskClass->ShouldIgnoreCharacterAssetIdsAndUseDietType())
 					{
-						if (KillTaskClass->ShouldIgnoreCharacterAssetIdsAndUseDietType())
+						for (AIBaseCharacter* RemotePawn : Characters)
 						{
-							for (AIBaseCharacter* RemotePawn : Characters)
-							{
-								if (!RemotePawn) continue;
+							if (!RemotePawn) continue;
 
-								bool bMeetsRequirements = RemotePawn->DietRequirements == KillTaskClass->GetDietaryRequirements();
+							bool bMeetsRequirements = RemotePawn->DietRequirements == KillTaskClass->GetDietaryRequirements();
 
-								if (bMeetsRequirements)
-								{
-									bMeetsRequirement = true;
-									break;
-								}
-							}
-						}
-						else
-						{
-							for (const FPrimaryAssetId& CharacterAssetId : CharacterAssedIds)
+							if (bMeetsRequirements)
 							{
-								bool bMeetsRequirements = KillTaskClass->GetCharacterAssetIds().Contains(CharacterAssetId);
-
-								if (bMeetsRequirements)
-								{
-									bMeetsRequirement = true;
-									break;
-								}
+								bMeetsRequirement = true;
+								break;
 							}
 						}
 					}
 					else
 					{
-						bMeetsRequirement = true;
-					}
+						for (const FPrimaryAssetId& CharacterAssetId : CharacterAssedIds)
+						{
+							bool bMeetsRequirements = KillTaskClass->GetCharacterAssetIds().Contains(CharacterAssetId);
 
-					if (bMeetsRequirement) break;
+							if (bMeetsRequirements)
+							{
+								bMeetsRequirement = true;
+								break;
+							}
+						}
+					}
+				}
+				else
+				{
+					bMeetsRequirement = true;
 				}
-			}
-
-			if (!bMeetsRequirement) continue;
-		}
-		else if (QuestData->QuestType == EQuestType::MoveTo)
-		{
-			float DistanceFromQuest = FVector::Distance(QuestData->WorldLocation, Character->GetActorLocation());
-			bool bMeetsRequirement = DistanceFromQuest < MaxQuestMoveToDistance;
-
-			if (!bMeetsRequirement) continue;
-		}
 
-		// Skip picking this personal quest if we have just completed it recently
-		// The amount of recently completed quests is tracked by MaxRecentCompletedQuests variable in header
-		if (!bAllowRepeatQuests && PreferredType == EQuestShareType::Personal)
-		{
-			if (HasCompletedQuest(RandomQuestSelection, Character)) continue;
-			if (HasFailedQuest(RandomQuestSelection, Character))
-			{
-				GEngine->AddOnScreenDebugMessage(-1, 3.f, FColor::Red, TEXT("HasFailedQuest"));
-				continue;
+				if (bMeetsRequirement) break;
 			}
 		}
 
-		// If we got this far we got a valid quest so return it
-		SelectedQuest = RandomQuestSelection;
+		if (!bMeetsRequirement) return false;
+	}
+	else if (QuestData->QuestType == EQuestType::MoveTo)
+	{
+		float DistanceFromQuest = FVector::Distance(QuestData->WorldLocation, Character->GetActorLocation());
+		bool bMeetsRequirement = DistanceFromQuest < MaxQuestMoveToDistance;
 
-		GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Green, FString::Printf(TEXT("AIQuestManager::GetRandomQuest - SelectedQuest: %s"), *SelectedQuest.ToString()));
-		QuestIDLoaded.ExecuteIfBound(SelectedQuest);
-		return;
+		if (!bMeetsRequirement) return false;
+	}
+
+	// Skip picking this personal quest if we have just completed it recently
+	// The amount of recently completed quests is tracked by MaxRecentCompletedQuests variable in header
+	if (!bAllowRepeatQuests && PreferredType == EQuestShareType::Personal)
+	{
+		if (HasCompletedQuest(RandomQuestSelection, Character)) return false;
+		if (HasFailedQuest(RandomQuestSelection, Character))
+		{
+			GEngine->AddOnScreenDebugMessage(-1, 3.f, FColor::Red, TEXT("HasFailedQuest"));
+			return false;
+		}
 	}
 
-	QuestIDLoaded.ExecuteIfBound(SelectedQuest);
-	return;
+	return true;
 }
 
 void AIQuestManager::GetRandomGroupQuest(AIPlayerGroupActor* PlayerGroupActor, FQuestIDLoaded QuestIDLoaded)
@@ -2146,12 +2504,14 @@ void AIQuestManager::AssignQuest(FPrimaryAssetId QuestAssetId, AIBaseCharacter*
 				if (bForGroup)
 				{
 					PlayerGroupActor->AddGroupQuest(NewQuest);
+					PublishQuestEvent(TargetCharacter, EQuestEvent::Refresh);
 					//GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Green, FString::Printf(TEXT("AIQuestManager::AssignQuest - PlayerGroupActor->GroupQuests.Add")));
 					PlayerGroupActor->OnRep_GroupQuest();
 				}
 				else
 				{
 					TargetCharacter->GetActiveQuests_Mutable().Add(NewQuest);
+					PublishQuestEvent(TargetCharacter, EQuestEvent::Refresh);
 #if !UE_SERVER
 					if (!IsRunningDedicatedServer())
 					{
@@ -2258,12 +2618,14 @@ void AIQuestManager::AssignQuestLoaded(FPrimaryAssetId QuestAssetId, AIBaseChara
 		{
 			//UE_LOG(TitansQuests, Error, TEXT("AIQuestManager::AssignQuestLoaded() - bForGroup"));
 			PlayerGroupActor->AddGroupQuest(NewQuest);
+			PublishQuestEvent(TargetCharacter, EQuestEvent::Refresh);
 			//GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Green, FString::Printf(TEXT("AIQuestManager::AssignQuestLoaded - PlayerGroupActor->GroupQuests.Add")));
 			PlayerGroupActor->OnRep_GroupQuest();
 		}
 		else
 		{
 			TargetCharacter->GetActiveQuests_Mutable().Add(NewQuest);
+			PublishQuestEvent(TargetCharacter, EQuestEvent::Refresh);
 
 #if !UE_SERVER
 			if (!IsRunningDedicatedServer())
@@ -2549,6 +2911,7 @@ void AIQuestManager::AssignLocalWorldQuest(FPrimaryAssetId QuestAssetId, AIBaseC
 			if (NewQuest->IsValidLowLevel())
 			{
 				TargetCharacter->GetActiveQuests_Mutable().Add(NewQuest);
+				PublishQuestEvent(TargetCharacter, EQuestEvent::Refresh);
 
 #if !UE_SERVER
 				if (!IsRunningDedicatedServer())
@@ -2626,6 +2989,7 @@ void AIQuestManager::AssignLocalWorldQuestLoaded(FPrimaryAssetId QuestAssetId, A
 		NewQuest->GetQuestTasks_Mutable() = NewQuestTasks;
 
 		TargetCharacter->GetActiveQuests_Mutable().Add(NewQuest);
+		PublishQuestEvent(TargetCharacter, EQuestEvent::Refresh);
 
 #if !UE_SERVER
 		if (!IsRunningDedicatedServer())
@@ -2925,6 +3289,8 @@ void AIQuestManager::UpdateGroupQuestsOnCooldown(FAlderonUID CharacterID, FPrima
 	{
 		GroupQuestsOnCooldown.Add(NewQuestCooldown);
 	}
+
+	GroupQuestCooldownExpiries.HeapPush(FQuestExpiry(WorldTimeSeconds, QuestId, CharacterID));
 }
 
 void AIQuestManager::ClearCompletedQuests(AIBaseCharacter* TargetCharacter)
@@ -3478,6 +3844,7 @@ void AIQuestManager::LoadQuests(AIBaseCharacter* Character, bool bMapHasChanged)
 		if (SavedQuest)
 		{
 			Character->GetActiveQuests_Mutable().Add(SavedQuest);
+			PublishQuestEvent(Character, EQuestEvent::Refresh);
 		}
 	}
 
@@ -3496,7 +3863,7 @@ void AIQuestManager::LoadQuests(AIBaseCharacter* Character, bool bMapHasChanged)
 		// We remove GroupMeetupTimeSpent from the TimeSeconds since the calculation is the Timestamp + Cooldown.
 		// This removes the time they have waited from the new quest timestamp
 		const float NewTimestamp = GetWorld()->TimeSeconds - Character->GroupMeetupTimeSpent;
-		GroupMeetQuestCooldowns.Add(FQuestCooldown(FPrimaryAssetId(), Character->GetCharacterID(), NewTimestamp));
+		AddGroupMeetQuestCooldown(FQuestCooldown(FPrimaryAssetId(), Character->GetCharacterID(), NewTimestamp));
 
 		// Time Remaining will be set again for save if the player logs out with a time remaining
 		Character->GroupMeetupTimeSpent = 0.0f;
@@ -3526,7 +3893,14 @@ void AIQuestManager::SaveQuest(AIBaseCharacter* Character)
 	if (!Character) return;
 	if (!Character->IsValidLowLevel()) return;
 
-	Character->QuestSaves.Empty(Character->GetActiveQuests().Num());
+	SerializeQuests(Character, Character->QuestSaves, Character->UncollectedRewardQuestSaves);
+}
+
+void AIQuestManager::SerializeQuests(const AIBaseCharacter* Character, TArray<FQuestSave>& OutQuestSaves, TArray<FQuestSave>& OutUncollectedRewardQuestSaves)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::SerializeQuests"))
+
+	OutQuestSaves.Empty(Character->GetActiveQuests().Num());
 
 	for (UIQuest* Quest : Character->GetActiveQuests())
 	{
@@ -3572,10 +3946,10 @@ void AIQuestManager::SaveQuest(AIBaseCharacter* Character)
 				}
 			}
 		}
-		Character->QuestSaves.Add(QuestSave);
+		OutQuestSaves.Add(QuestSave);
 	}
 
-	Character->UncollectedRewardQuestSaves.Empty(Character->GetUncollectedRewardQuests().Num());
+	OutUncollectedRewardQuestSaves.Empty(Character->GetUncollectedRewardQuests().Num());
 
 	for (UIQuest* Quest : Character->GetUncollectedRewardQuests())
 	{
@@ -3614,7 +3988,7 @@ void AIQuestManager::SaveQuest(AIBaseCharacter* Character)
 			}
 		}
 
-		Character->UncollectedRewardQuestSaves.Add(QuestSave);
+		OutUncollectedRewardQuestSaves.Add(QuestSave);
 	}
 }
 
@@ -3837,7 +4211,7 @@ void AIQuestManager::OnQuestFail(AIBaseCharacter* TargetCharacter, UIQuest* Targ
 	{
 		if (TargetQuest->QuestData->QuestType == EQuestType::GroupMeet)
 		{
-			GroupMeetQuestCooldowns.Add(FQuestCooldown(TargetQuest->GetQuestId(), TargetCharacter->GetCharacterID(), (float)GetWorld()->TimeSeconds));
+			AddGroupMeetQuestCooldown(FQuestCooldown(TargetQuest->GetQuestId(), TargetCharacter->GetCharacterID(), (float)GetWorld()->TimeSeconds));
 		}
 		else if (GroupQuestCleanupDelay > 0.0f)
 		{
@@ -4190,7 +4564,7 @@ void AIQuestManager::OnQuestCompleted(AIBaseCharacter* TargetCharacter, UIQuest*
 	{
 		if (TargetQuest->QuestData->QuestType == EQuestType::GroupMeet)
 		{
-			GroupMeetQuestCooldowns.Add(FQuestCooldown(TargetQuest->GetQuestId(), TargetCharacter->GetCharacterID(), (float)GetWorld()->TimeSeconds));
+			AddGroupMeetQuestCooldown(FQuestCooldown(TargetQuest->GetQuestId(), TargetCharacter->GetCharacterID(), (float)GetWorld()->TimeSeconds));
 		}
 		else if (GroupQuestCleanupDelay > 0.0f)
 		{
@@ -4213,7 +4587,7 @@ void AIQuestManager::OnQuestCompleted(AIBaseCharacter* TargetCharacter, UIQuest*
 
 	if (TargetQuest->QuestData->QuestType == EQuestType::TrophyDelivery)
 	{
-		GetTrophyQuestsOnCooldown_Mutable().Add(FQuestCooldown(TargetQuest->GetQuestId(), TargetCharacter->GetCharacterID(), (float)GetWorld()->TimeSeconds));
+		AddTrophyQuestCooldown(FQuestCooldown(TargetQuest->GetQuestId(), TargetCharacter->GetCharacterID(), (float)GetWorld()->TimeSeconds));
 	}
 
 	// Cache Reward Points to reward the player after the quest has been destroyed
@@ -4500,6 +4874,8 @@ void AIQuestManager::OnCharacterKilled(AIBaseCharacter* Killer, AIBaseCharacter*
 		return;
 	}
 
+	PublishQuestEvent(Killer, EQuestEvent::Kill);
+
 	FPrimaryAssetId VictimCharacterDataAssetId = Victim->CharacterDataAssetId;
 	if (!VictimCharacterDataAssetId.IsValid()) return;
 
@@ -4513,77 +4889,156 @@ void AIQuestManager::OnCharacterKilled(AIBaseCharacter* Killer, AIBaseCharacter*
 	check(Session);
 	if (!Session) return;
 
-	// Killer has a active quest let's update it's tasks
-	TArray<UIQuest*> QuestsToCheck = Killer->GetActiveQuests();
-	for (UIQuest* KillersQuest : QuestsToCheck)
+	// Only the kill tasks indexed under the victim can advance
+	UIQuest* KillersQuest = nullptr;
+	if (UIQuestKillTask* const KillTask = FindKillTaskForVictim(Killer, Victim, KillersQuest))
 	{
-		if (!KillersQuest) continue;
+		KillTask->Increment();
+		bProgressGained = true;
 
-		for (UIQuestBaseTask* QuestTask : KillersQuest->GetQuestTasks())
+		if (KillersQuest->QuestData->bRewardBasedOnContribution)
 		{
-			// Process Only Kill Tasks
-			UIQuestKillTask* KillTask = Cast<UIQuestKillTask>(QuestTask);
-			if (!KillTask) continue;
+			OnContributeRestore(KillTask->Tag, 1.0f, Killer, KillersQuest);
+		}
+
+		// Give Reward Per Kill
+		float KillerGrowth = Killer->GetGrowthPercent();
+		float VictimGrowth = Victim->GetGrowthPercent();
+
+		float RewardMultiplier = KillTask->IsRewardBasedUponSizeDifference() ? VictimGrowth / KillerGrowth : 1.0f;
+
+		int32 RewardPoints = KillTask->RewardPoints;
+		float RewardGrowth = KillTask->GetRewardGrowth();
+
+		if (RewardPoints > 0)
+		{
+			// Apply Reward Multiplier
+			RewardPoints *= RewardMultiplier;
+
+			UCharacterDataAsset* CharacterDataAsset = UIGameInstance::LoadCharacterData(Killer->CharacterDataAssetId);
+			check(CharacterDataAsset);
+
+			// Apply Server Quest Marks Reward Multiplier
+			RewardPoints *= Session->QuestMarksMultiplier;
+
+			// Apply Character Reward Multiplier
+			RewardPoints *= CharacterDataAsset->QuestRewaredMultiplier;
 
-			if ((KillTask->ShouldIgnoreCharacterAssetIdsAndUseDietType() && Victim->DietRequirements == KillTask->GetDietaryRequirements()) || (KillTask->GetCharacterAssetIds().Contains(VictimCharacterDataAssetId)))
+			// Add Reward Marks
+			Killer->AddMarks(RewardPoints);
+		}
+
+		if (RewardGrowth > 0)
+		{
+			// Apply Reward Multiplier
+			RewardGrowth *= RewardMultiplier;
+
+			if (Session->QuestGrowthMultiplier > 0.f)
 			{
-				KillTask->Increment();
-				bProgressGained = true;
+				// Growth is applied at the same rate but different durations, depending on growth amount
+				// Set to grow at a rate of up to 0.1 growth over 1 minute
+				const float GrowthReward = Killer->GetGrowthPercent() <= Session->HatchlingCaveExitGrowth && !Killer->HasLeftHatchlingCave() ? BabyGrowthRewardRatePerMinute : GrowthRewardRatePerMinute;
+				UPOTAbilitySystemGlobals::RewardGrowthConstantRate(Killer, RewardGrowth * Session->QuestGrowthMultiplier, GrowthReward / 60.f);
+			}
+		}
 
-				if (KillersQuest->QuestData->bRewardBasedOnContribution)
-				{
-					OnContributeRestore(QuestTask->Tag, 1.0f, Killer, KillersQuest);
-				}
+		OnQuestUpdated(Killer, KillersQuest, bProgressGained);
+	}
+}
 
-				// Give Reward Per Kill
-				float KillerGrowth = Killer->GetGrowthPercent();
-				float VictimGrowth = Victim->GetGrowthPercent();
+FQuestKillTaskIndex& AIQuestManager::GetKillTaskIndex(AIBaseCharacter* Character)
+{
+	const TArray<UIQuest*>& ActiveQuests = Character->GetActiveQuests();
 
-				float RewardMultiplier = KillTask->IsRewardBasedUponSizeDifference() ? VictimGrowth / KillerGrowth : 1.0f;
+	uint32 QuestsSignature = GetTypeHash(ActiveQuests.Num());
+	for (const UIQuest* const ActiveQuest : ActiveQuests)
+	{
+		QuestsSignature = HashCombine(QuestsSignature, GetTypeHash(ActiveQuest));
+		QuestsSignature = HashCombine(QuestsSignature, GetTypeHash(ActiveQuest ? ActiveQuest->GetQuestTasks().Num() : 0));
+	}
 
-				int32 RewardPoints = KillTask->RewardPoints;
-				float RewardGrowth = KillTask->GetRewardGrowth();
+	FQuestKillTaskIndex& KillTaskIndex = KillTaskIndices.FindOrAdd(Character);
+	if (KillTaskIndex.bBuilt && KillTaskIndex.QuestsSignature == QuestsSignature)
+	{
+		return KillTaskIndex;
+	}
 
-				if (RewardPoints > 0)
-				{
-					// Apply Reward Multiplier
-					RewardPoints *= RewardMultiplier;
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::GetKillTaskIndex"))
 
-					UCharacterDataAsset* CharacterDataAsset = UIGameInstance::LoadCharacterData(Killer->CharacterDataAssetId);
-					check(CharacterDataAsset);
+	KillTaskIndex.ByCharacterAssetId.Reset();
+	KillTaskIndex.ByDiet.Reset();
+	KillTaskIndex.QuestsSignature = QuestsSignature;
+	KillTaskIndex.bBuilt = true;
 
-					// Apply Server Quest Marks Reward Multiplier
-					RewardPoints *= Session->QuestMarksMultiplier;
+	int32 Order = 0;
+	for (UIQuest* const ActiveQuest : ActiveQuests)
+	{
+		if (!ActiveQuest) continue;
 
-					// Apply Character Reward Multiplier
-					RewardPoints *= CharacterDataAsset->QuestRewaredMultiplier;
+		for (UIQuestBaseTask* const QuestTask : ActiveQuest->GetQuestTasks())
+		{
+			UIQuestKillTask* const KillTask = Cast<UIQuestKillTask>(QuestTask);
+			if (!KillTask) continue;
 
-					// Add Reward Marks
-					Killer->AddMarks(RewardPoints);
-				}
+			const FQuestKillTaskRef TaskRef{ ActiveQuest, KillTask, Order++ };
 
-				if (RewardGrowth > 0)
-				{
-					// Apply Reward Multiplier
-					RewardGrowth *= RewardMultiplier;
+			if (KillTask->ShouldIgnoreCharacterAssetIdsAndUseDietType())
+			{
+				KillTaskIndex.ByDiet.FindOrAdd(KillTask->GetDietaryRequirements()).Add(TaskRef);
+			}
 
-					if (Session->QuestGrowthMultiplier > 0.f)
-					{
-						// Growth is applied at the same rate but different durations, depending on growth amount
-						// Set to grow at a rate of up to 0.1 growth over 1 minute
-						const float GrowthReward = Killer->GetGrowthPercent() <= Session->HatchlingCaveExitGrowth && !Killer->HasLeftHatchlingCave() ? BabyGrowthRewardRatePerMinute : GrowthRewardRatePerMinute;
-						UPOTAbilitySystemGlobals::RewardGrowthConstantRate(Killer, RewardGrowth * Session->QuestGrowthMultiplier, GrowthReward / 60.f);
-					}
-				}
+			for (const FPrimaryAssetId& CharacterAssetId : KillTask->GetCharacterAssetIds())
+			{
+				TArray<FQuestKillTaskRef>& TaskRefs = KillTaskIndex.ByCharacterAssetId.FindOrAdd(CharacterAssetId);
 
-				break;
+				// A task listing the same asset twice only needs to be found once
+				if (TaskRefs.IsEmpty() || TaskRefs.Last().Order != TaskRef.Order)
+				{
+					TaskRefs.Add(TaskRef);
+				}
 			}
 		}
+	}
 
-		OnQuestUpdated(Killer, KillersQuest, bProgressGained);
+	return KillTaskIndex;
+}
+
+UIQuestKillTask* AIQuestManager::FindKillTaskForVictim(AIBaseCharacter* Killer, const AIBaseCharacter* Victim, UIQuest*& OutQuest)
+{
+	OutQuest = nullptr;
+
+	const FQuestKillTaskIndex& KillTaskIndex = GetKillTaskIndex(Killer);
+
+	const FQuestKillTaskRef* BestTaskRef = nullptr;
+
+	// Both lists are in quest order, so the first task in each that can still advance is a candidate
+	auto ConsiderTasks = [&BestTaskRef](const TArray<FQuestKillTaskRef>* TaskRefs)
+	{
+		if (!TaskRefs) return;
+
+		for (const FQuestKillTaskRef& TaskRef : *TaskRefs)
+		{
+			if (BestTaskRef && BestTaskRef->Order < TaskRef.Order) return;
+
+			const UIQuestKillTask* const KillTask = TaskRef.Task.Get();
+			const UIQuest* const Quest = TaskRef.Quest.Get();
+			if (!KillTask || !Quest || !Quest->QuestData || KillTask->IsCompleted()) continue;
+
+			BestTaskRef = &TaskRef;
+			return;
+		}
+	};
 
-		if (bProgressGained) break;
+	ConsiderTasks(KillTaskIndex.ByCharacterAssetId.Find(Victim->CharacterDataAssetId));
+	ConsiderTasks(KillTaskIndex.ByDiet.Find(Victim->DietRequirements));
+
+	if (!BestTaskRef)
+	{
+		return nullptr;
 	}
+
+	OutQuest = BestTaskRef->Quest.Get();
+	return BestTaskRef->Task.Get();
 }
 
 void AIQuestManager::OnFishKilled(AIBaseCharacter* Killer, AIFish* Fish)
@@ -4600,6 +5055,8 @@ void AIQuestManager::OnFishKilled(AIBaseCharacter* Killer, AIFish* Fish)
 	check(Killer);
 	check(Fish);
 
+	PublishQuestEvent(Killer, EQuestEvent::FishCaught);
+
 	bool bProgressGained = false;
 
 	// Since quests can be completed and removed from Killer->ActiveQuests, we need to create a temporary array for these to prevent a crash -Poncho
@@ -4653,6 +5110,8 @@ void AIQuestManager::OnCritterKilled(AIBaseCharacter* Killer, AICritterPawn* Cri
 	check(Killer);
 	check(Critter);
 
+	PublishQuestEvent(Killer, EQuestEvent::Kill);
+
 	FPrimaryAssetId CritterProfile;
 	if (AAlderonCritterController* AlderonCritterController = Cast<AAlderonCritterController>(Critter->GetController()))
 	{
@@ -4721,6 +5180,8 @@ void AIQuestManager::OnLocationDiscovered(FName LocationTag, const FText& Locati
 	AIPlayerState* IPlayerState = IPlayerController->GetPlayerState<AIPlayerState>();
 	if (!IPlayerState) return;
 
+	PublishQuestEvent(Character, EQuestEvent::LocationDiscovered);
+
 	TArray<UIQuest*> QuestsToCheck = Character->GetActiveQuests();
 
 	// Get Local World Quests assigned to the player
@@ -4847,6 +5308,8 @@ void AIQuestManager::OnItemCollected(FName ItemTag, AIBaseCharacter* Character,
 	AIGameState* IGameState = UIGameplayStatics::GetIGameState(this);
 	if (!IGameState) return;
 
+	PublishQuestEvent(Character, EQuestEvent::ItemCollected);
+
 	// Collector has an active quest let's update its tasks
 	TArray<UIQuest*> QuestsToCheck = Character->GetActiveQuests();
 	for (UIQuest* CollectorQuest : QuestsToCheck)
@@ -4920,6 +5383,8 @@ void AIQuestManager::OnItemDelivered(FName ItemTag, AIBaseCharacter* Character,
 	// Character is Valid
 	check(Character);
 
+	PublishQuestEvent(Character, EQuestEvent::ItemDelivered);
+
 	// Character has a active quest let's update it's tasks
 	TArray<UIQuest*> QuestsToCheck = Character->GetActiveQuests();
 	for (UIQuest* DeliveryQuest : QuestsToCheck)
@@ -5033,6 +5498,8 @@ void AIQuestManager::OnWaterRestore(FName WaterTag, float RestoreValue, AIBaseCh
 
 	if (!Character || !Quest) return;
 
+	PublishGlobalQuestEvent(EQuestEvent::WaterRestored);
+
 	if (AIWaterManager* WaterMgr = AIWorldSettings::GetWorldSettings(this)->WaterManager)
 	{
 		WaterMgr->UpdateBodyOfWater(WaterTag, RestoreValue, 0.0f, 0.0f);
@@ -5045,6 +5512,8 @@ void AIQuestManager::OnWaterQualityDroppedBelowThreshold(FWaterData WaterData, F
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::OnWaterQualityDroppedBelowThreshold"))
 
+	PublishGlobalQuestEvent(EQuestEvent::WaterRestored);
+
 	TArray<FPrimaryAssetId> Quests = WaterRestoreQuests;
 	if (Quests.IsEmpty() || WaterData.WaterTag == NAME_None) return;
 
@@ -5117,6 +5586,8 @@ void AIQuestManager::OnWaterQualityRestored(FWaterData WaterData, FWaterLocation
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::OnWaterQualityRestored"))
 
+	PublishGlobalQuestEvent(EQuestEvent::WaterRestored);
+
 	if (!GetWorld()) return;
 	TArray<FPrimaryAssetId> Quests = WaterRestoreQuests;
 	if (Quests.IsEmpty() == 0 || WaterData.WaterTag == NAME_None) return;
@@ -5150,6 +5621,8 @@ void AIQuestManager::OnWaterQualityRestored(FWaterData WaterData, FWaterLocation
 			QuestContribution.Timestamp = TimeSeconds;
 		}
 	}
+
+	TrackContributionExpiry(QuestId, TimeSeconds);
 }
 
 void AIQuestManager::OnWaystoneRestore(FName WaystoneTag, int32 RestoreValue, AIBaseCharacter* Character, UIQuest* Quest)
@@ -5158,6 +5631,8 @@ void AIQuestManager::OnWaystoneRestore(FName WaystoneTag, int32 RestoreValue, AI
 
 	if (!Character || !Quest) return;
 
+	PublishGlobalQuestEvent(EQuestEvent::WaystoneRestored);
+
 	if (AIWaystoneManager* WaystoneMgr = AIWorldSettings::GetWorldSettings(this)->WaystoneManager)
 	{
 		WaystoneMgr->ModifyWaystoneData(WaystoneTag, RestoreValue);
@@ -5172,6 +5647,8 @@ void AIQuestManager::OnWaystoneCooldownActivated(FName WaystoneTag)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::OnWaystoneCooldownActivated"))
 
+	PublishGlobalQuestEvent(EQuestEvent::WaystoneRestored);
+
 	TArray<FPrimaryAssetId> Quests = WaystoneRestoreQuests;
 	if (Quests.IsEmpty() || WaystoneTag == NAME_None || ActiveWaystoneRestoreQuestTags.Contains(WaystoneTag)) return;
 
@@ -5257,6 +5734,8 @@ void AIQuestManager::OnWaystoneCooldownDeactivated(FName WaystoneTag, bool bFrom
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::OnWaystoneCooldownDeactivated"))
 
+	PublishGlobalQuestEvent(EQuestEvent::WaystoneRestored);
+
 	if (!GetWorld()) return;
 	TArray<FPrimaryAssetId> Quests = WaystoneRestoreQuests;
 	if (Quests.IsEmpty() == 0 || WaystoneTag == NAME_None) return;
@@ -5309,6 +5788,8 @@ void AIQuestManager::OnWaystoneCooldownDeactivated(FName WaystoneTag, bool bFrom
 		}
 	}
 
+	TrackContributionExpiry(QuestId, TimeSeconds);
+
 	if (bNeedsDirtying)
 	{
 		MARK_PROPERTY_DIRTY_FROM_NAME(AIQuestManager, QuestContributions, this);
@@ -5489,6 +5970,7 @@ void AIQuestManager::LoadQuestAssets()
 	SCOPE_CYCLE_COUNTER(STAT_QuestLoadQuestAssets);
 
 	bQuestsLoaded = false;
+	InvalidateQuestAssetPools();
 
 	TArray<FPrimaryAssetId> QuestAssetIds;
 
@@ -5568,6 +6050,8 @@ void AIQuestManager::OnLoadQuestAssets(TArray<UQuestData*> QuestsData)
 
 	bQuestsLoaded = true;
 
+	BuildQuestAssetPools();
+
 #if !UE_BUILD_SHIPPING
 	UE_LOG(TitansQuests, Log, TEXT("AIQuestManager::LoadQuestAssets() - QuestAssetIds: %s"), *FString::FromInt(QuestsData.Num()));
 	UE_LOG(TitansQuests, Log, TEXT("AIQuestManager::LoadQuestAssets() - MultiCarnivoreQuests: %s"), *FString::FromInt(MultiCarnivoreQuests.Num()));
@@ -5619,6 +6103,25 @@ void AIQuestManager::GetLoadedQuestAssetIDsFromType(EQuestFilter QuestFilter, co
 
 	SCOPE_CYCLE_COUNTER(STAT_GetLoadedQuestAssetIDsFromType);
 
+	// Quest data was loaded with the quest lists, so the cached pools can answer right away
+	if (bQuestAssetPoolsValid && QuestAssetPools.IsValidIndex(static_cast<int32>(QuestFilter)))
+	{
+		TArray<FPrimaryAssetId> QuestAssets;
+
+		if (const FQuestAssetPoolSlice* const UniqueQuests = FindUniqueQuests(QuestFilter, Character))
+		{
+			QuestAssets.Append(UniqueQuests->QuestIds);
+		}
+
+		QuestAssets.Append(QuestAssetPools[static_cast<int32>(QuestFilter)].QuestIds);
+
+		if (!QuestAssets.IsEmpty())
+		{
+			OnLoadAssetsDelegate.ExecuteIfBound(QuestAssets);
+		}
+		return;
+	}
+
 	const bool bSinglePlayerQuest = QuestFilter == EQuestFilter::SINGLE_HERB || QuestFilter == EQuestFilter::SINGLE_CARNI || QuestFilter == EQuestFilter::SINGLE_ALL;
 	const bool bMultiPlayerQuest = QuestFilter == EQuestFilter::MULTI_HERB || QuestFilter == EQuestFilter::MULTI_CARNI || QuestFilter == EQuestFilter::MULTI_ALL;
 
@@ -5897,6 +6400,229 @@ void AIQuestManager::OnLoadedQuestAssetIDsFromType(TArray<UQuestData*> QuestsDat
 	}
 }
 
+void AIQuestManager::InvalidateQuestAssetPools()
+{
+	QuestAssetPools.Reset();
+	SingleUniqueQuestsByCharacter.Reset();
+	MultiUniqueQuestsByCharacter.Reset();
+	bQuestAssetPoolsValid = false;
+}
+
+void AIQuestManager::BuildQuestAssetPools()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::BuildQuestAssetPools"))
+
+	InvalidateQuestAssetPools();
+	QuestAssetPools.SetNum(static_cast<int32>(EQuestFilter::MAX));
+
+	struct FPoolEntry
+	{
+		FPrimaryAssetId QuestId;
+		UQuestData* QuestData = nullptr;
+	};
+
+	auto AddToSlice = [](FQuestAssetPoolSlice& Slice, const FPoolEntry& Entry)
+	{
+		Slice.QuestIds.Add(Entry.QuestId);
+		Slice.GrowthRequirements.Add(Entry.QuestData->GrowthRequirement);
+		Slice.QuestData.Add(Entry.QuestData);
+	};
+
+	TArray<FPoolEntry> Entries;
+
+	for (int32 FilterIndex = 0; FilterIndex < QuestAssetPools.Num(); FilterIndex++)
+	{
+		FQuestAssetPool& Pool = QuestAssetPools[FilterIndex];
+
+		// Same filter -> quest list mapping as the uncached path, without a character no unique quests are added
+		FQuestsIDsLoaded CollectQuestIds;
+		CollectQuestIds.BindLambda([&Pool](TArray<FPrimaryAssetId> FilteredQuestIds)
+		{
+			Pool.QuestIds = MoveTemp(FilteredQuestIds);
+		});
+
+		OnLoadedQuestAssetIDsFromType(TArray<UQuestData*>(), static_cast<EQuestFilter>(FilterIndex), nullptr, CollectQuestIds);
+
+		// Disabled quests are never drawn, so they don't need to be in the drawable slices
+		Entries.Reset(Pool.QuestIds.Num());
+		for (const FPrimaryAssetId& QuestId : Pool.QuestIds)
+		{
+			// Every listed quest was loaded by LoadQuestAssets, so this is only a lookup
+			UQuestData* const QuestData = LoadQuestData(QuestId);
+			if (QuestData && QuestData->bEnabled)
+			{
+				Entries.Add({ QuestId, QuestData });
+			}
+		}
+
+		Algo::StableSortBy(Entries, [](const FPoolEntry& Entry) { return Entry.QuestData->GrowthRequirement; });
+
+		for (const FPoolEntry& Entry : Entries)
+		{
+			AddToSlice(Pool.Drawable, Entry);
+			AddToSlice(Pool.DrawableByTag.FindOrAdd(Entry.QuestData->QuestTag), Entry);
+		}
+	}
+
+	auto IndexUniqueQuests = [this, &AddToSlice](const TArray<FPrimaryAssetId>& UniqueQuests, TMap<FPrimaryAssetId, FQuestAssetPoolSlice>& OutQuestsByCharacter)
+	{
+		for (const FPrimaryAssetId& QuestId : UniqueQuests)
+		{
+			UQuestData* const QuestData = LoadQuestData(QuestId);
+			if (QuestData && QuestData->bEnabled)
+			{
+				AddToSlice(OutQuestsByCharacter.FindOrAdd(QuestData->RestrictCharacterAssetId), { QuestId, QuestData });
+			}
+		}
+	};
+
+	IndexUniqueQuests(SingleUniqueQuests, SingleUniqueQuestsByCharacter);
+	IndexUniqueQuests(BothUniqueQuests, SingleUniqueQuestsByCharacter);
+	IndexUniqueQuests(MultiUniqueQuests, MultiUniqueQuestsByCharacter);
+	IndexUniqueQuests(BothUniqueQuests, MultiUniqueQuestsByCharacter);
+
+	bQuestAssetPoolsValid = true;
+}
+
+const FQuestAssetPoolSlice* AIQuestManager::FindUniqueQuests(EQuestFilter QuestFilter, const AIBaseCharacter* Character) const
+{
+	if (!Character)
+	{
+		return nullptr;
+	}
+
+	switch (QuestFilter)
+	{
+		case EQuestFilter::SINGLE_CARNI:
+		case EQuestFilter::SINGLE_HERB:
+		case EQuestFilter::SINGLE_ALL:
+			return SingleUniqueQuestsByCharacter.Find(Character->CharacterDataAssetId);
+		case EQuestFilter::MULTI_CARNI:
+		case EQuestFilter::MULTI_HERB:
+		case EQuestFilter::MULTI_ALL:
+			return MultiUniqueQuestsByCharacter.Find(Character->CharacterDataAssetId);
+		default:
+			return nullptr;
+	}
+}
+
+bool AIQuestManager::DrawRandomQuestFromPool(EQuestFilter QuestFilter, AIBaseCharacter* Character, EQuestShareType PreferredType, EQuestType ActivePersonalQuestType, FQuestIDLoaded QuestIDLoaded)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::DrawRandomQuestFromPool"))
+
+	if (!bQuestAssetPoolsValid || !Character || !QuestAssetPools.IsValidIndex(static_cast<int32>(QuestFilter)))
+	{
+		return false;
+	}
+
+	const FQuestAssetPool& Pool = QuestAssetPools[static_cast<int32>(QuestFilter)];
+	const bool bGrowthEnabled = UIGameplayStatics::IsGrowthEnabled(this);
+	const float GrowthPercent = Character->GetGrowthPercent();
+
+	// Slices the character can draw from and how many of each it has grown into, drawn as if they were one list
+	TArray<TPair<const FQuestAssetPoolSlice*, int32>, TInlineAllocator<8>> Slices;
+	int32 NumCandidates = 0;
+
+	auto AddSlice = [&Slices, &NumCandidates, bGrowthEnabled, GrowthPercent](const FQuestAssetPoolSlice* Slice, bool bSortedByGrowth)
+	{
+		if (!Slice)
+		{
+			return;
+		}
+
+		const int32 NumEligible = bGrowthEnabled && bSortedByGrowth ? Algo::UpperBound(Slice->GrowthRequirements, GrowthPercent) : Slice->QuestIds.Num();
+		if (NumEligible > 0)
+		{
+			Slices.Emplace(Slice, NumEligible);
+			NumCandidates += NumEligible;
+		}
+	};
+
+	// Unique quests aren't sorted, the eligibility check gates their growth
+	AddSlice(FindUniqueQuests(QuestFilter, Character), false);
+
+	// Characters with quest tags only get quests sharing one of their tags, or untagged ones
+	if (Character->QuestTags.IsEmpty())
+	{
+		AddSlice(&Pool.Drawable, true);
+	}
+	else
+	{
+		AddSlice(Pool.DrawableByTag.Find(NAME_QuestTagNone), true);
+		for (int32 TagIndex = 0; TagIndex < Character->QuestTags.Num(); TagIndex++)
+		{
+			const FName& QuestTag = Character->QuestTags[TagIndex];
+			bool bAlreadyAdded = QuestTag == NAME_QuestTagNone;
+			for (int32 OtherIndex = 0; OtherIndex < TagIndex && !bAlreadyAdded; OtherIndex++)
+			{
+				bAlreadyAdded = Character->QuestTags[OtherIndex] == QuestTag;
+			}
+
+			if (!bAlreadyAdded)
+			{
+				AddSlice(Pool.DrawableByTag.Find(QuestTag), true);
+			}
+		}
+	}
+
+	if (NumCandidates == 0)
+	{
+		return true;
+	}
+
+	FRandomQuestDraw Draw;
+	if (!BeginRandomQuestDraw(Character, Draw))
+	{
+		return true;
+	}
+
+	// Lazy Fisher-Yates, each draw picks one index from the candidates not tried yet and only remembers the swaps it made
+	TMap<int32, int32> Swapped;
+	for (int32 NumRemaining = NumCandidates; NumRemaining > 0; NumRemaining--)
+	{
+		const int32 Pick = FMath::RandRange(0, NumRemaining - 1);
+		const int32* const PickedSwap = Swapped.Find(Pick);
+		int32 CandidateIndex = PickedSwap ? *PickedSwap : Pick;
+
+		const int32* const LastSwap = Swapped.Find(NumRemaining - 1);
+		Swapped.Add(Pick, LastSwap ? *LastSwap : NumRemaining - 1);
+
+		const FQuestAssetPoolSlice* Slice = nullptr;
+		for (const TPair<const FQuestAssetPoolSlice*, int32>& Pair : Slices)
+		{
+			if (CandidateIndex < Pair.Value)
+			{
+				Slice = Pair.Key;
+				break;
+			}
+			CandidateIndex -= Pair.Value;
+		}
+		check(Slice);
+
+		UQuestData* const QuestData = Slice->QuestData[CandidateIndex].Get();
+		if (!QuestData)
+		{
+			continue;
+		}
+
+		const FPrimaryAssetId& QuestId = Slice->QuestIds[CandidateIndex];
+		if (IsRandomQuestEligible(Character, PreferredType, ActivePersonalQuestType, QuestId, QuestData, Draw))
+		{
+			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Green, FString::Printf(TEXT("AIQuestManager::GetRandomQuest - SelectedQuest: %s"), *QuestId.ToString()));
+			QuestIDLoaded.ExecuteIfBound(QuestId);
+			return true;
+		}
+	}
+
+	// Same fallback as OnGetRandomQuest once every candidate was tried
+	if (PreferredType == EQuestShareType::Personal && Draw.ClosestPOIQuest.IsValid())
+	{
+		QuestIDLoaded.ExecuteIfBound(Draw.ClosestPOIQuest);
+	}
+
+	return true;
+}
+
 TArray<FPrimaryAssetId> AIQuestManager::ConvertObjectsToAssets(TArray<UObject*> QuestObjects) const
 {
 	TArray<FPrimaryAssetId> QuestAssets;
@@ -6010,6 +6736,29 @@ TArray<FQuestCooldown> AIQuestManager::GetLocalWorldQuestsOnCooldown()
 	return Cooldowns;
 }
 
+void AIQuestManager::PruneLocalWorldQuestCooldowns()
+{
+	AIGameState* IGameState = UIGameplayStatics::GetIGameState(this);
+	if (!IGameState) return;
+
+	const int64 NowTimestamp = FDateTime::UtcNow().ToUnixTimestamp();
+	const float CleanupDelay = (UE_BUILD_SHIPPING) ? LocalQuestCooldownDelay : 60.0f;
+
+	for (APlayerState* PlayerState : IGameState->PlayerArray)
+	{
+		AIPlayerState* RemotePlayerState = Cast<AIPlayerState>(PlayerState);
+		if (!RemotePlayerState || !RemotePlayerState->GetCharacterAssetId().IsValid()) continue;
+
+		AIBaseCharacter* RemotePawn = Cast<AIBaseCharacter>(RemotePlayerState->GetPawn());
+		if (!RemotePawn || RemotePawn->QuestCooldowns.IsEmpty()) continue;
+
+		RemotePawn->QuestCooldowns.RemoveAll([NowTimestamp, CleanupDelay](const FQuestCooldown& QuestCooldown)
+		{
+			return QuestCooldown.IsExpired(NowTimestamp, CleanupDelay);
+		});
+	}
+}
+
 void AIQuestManager::AddLocalWorldQuestCooldown(const FQuestCooldown& Cooldown)
 {
 	AIGameState* IGameState = UIGameplayStatics::GetIGameState(this);
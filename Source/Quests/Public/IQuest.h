@@ -125,6 +125,31 @@ enum class EQuestRewardClaimType : uint8
 	Manual      UMETA(DisplayName = "Manual")
 };
 
+// Things that can move quest tasks along, the quest tick only updates tasks subscribed to an event that happened
+enum class EQuestEvent : uint8
+{
+	Kill,
+	FishCaught,
+	ItemCollected,
+	ItemDelivered,
+	LocationDiscovered,
+	WaterRestored,
+	WaystoneRestored,
+	StatChanged,
+	// Updates every task and re-checks quest requirements, used for newly assigned quests and the fallback sweep
+	Refresh,
+	MAX
+};
+
+typedef uint32 FQuestEventMask;
+
+static constexpr FQuestEventMask AllQuestEvents = MAX_uint32;
+
+FORCEINLINE FQuestEventMask QuestEventBit(EQuestEvent Event)
+{
+	return 1u << static_cast<uint32>(Event);
+}
+
 USTRUCT(BlueprintType)
 struct FQuestItemData
 {
@@ -371,6 +396,9 @@ public:
 	virtual void Update(AIBaseCharacter* QuestOwner, UIQuest* ActiveQuest) {};
 	virtual void Setup() override;
 
+	// Events that can change what Update works out, tasks without any are only updated by the fallback sweep
+	virtual FQuestEventMask GetSubscribedQuestEvents() const { return 0; }
+
 	UFUNCTION(BlueprintCallable, Category = Quest)
 	virtual FText GetTaskText(bool bShowProgress = true) { return FText::FromString("Unknown"); }
 
@@ -474,6 +502,8 @@ public:
 
 	virtual void Update(AIBaseCharacter* QuestOwner, UIQuest* ActiveQuest) override;
 
+	virtual FQuestEventMask GetSubscribedQuestEvents() const override { return QuestEventBit(EQuestEvent::StatChanged); }
+
 	virtual FText GetTaskText(bool bShowProgress = true) override { return TaskText; }
 	
 	virtual bool IsCompleted() const override { return bCompleted; }
@@ -595,6 +625,7 @@ public:
 	virtual int GetProgressCount() override { return CurrentKillCount; }
 	virtual int GetProgressTotal() override { return TotalKillCount; }
 	virtual bool IsCompleted() const override { return CurrentKillCount >= TotalKillCount; }
+	virtual FQuestEventMask GetSubscribedQuestEvents() const override { return QuestEventBit(EQuestEvent::Kill); }
 
 	UFUNCTION()
 	void OnRep_CurrentKillCount();
@@ -615,6 +646,8 @@ public:
 
 	virtual FText GetTaskText(bool bShowProgress = true) override;
 
+	virtual FQuestEventMask GetSubscribedQuestEvents() const override { return QuestEventBit(EQuestEvent::FishCaught); }
+
 	FORCEINLINE ECarriableSize GetFishSize() const { return FishSize; }
 
 protected:
@@ -647,6 +680,8 @@ public:
 	virtual FText GetTaskText(bool bShowProgress = true) override;
 	
 	virtual bool IsCompleted() const override;
+
+	virtual FQuestEventMask GetSubscribedQuestEvents() const override { return QuestEventBit(EQuestEvent::LocationDiscovered); }
 	
 	void SetIsCompleted(bool bSetCompleted);
 	
@@ -747,6 +782,7 @@ public:
 
 	void Increment();
 	virtual void Update(AIBaseCharacter* QuestOwner, UIQuest* ActiveQuest) override;
+	virtual FQuestEventMask GetSubscribedQuestEvents() const override { return QuestEventBit(EQuestEvent::ItemCollected) | QuestEventBit(EQuestEvent::ItemDelivered); }
 	virtual FText GetTaskText(bool bShowProgress = true) override;
 	UFUNCTION(BlueprintCallable, Category = Quest)
 	virtual bool GetItemDescriptiveText(FName QuestItemTag, FText& DescriptiveText);
@@ -799,6 +835,7 @@ class PATHOFTITANS_API UIQuestWaterRestoreTask : public UIQuestItemTask
 public:
 
 	virtual void Update(AIBaseCharacter* QuestOwner, UIQuest* ActiveQuest) override;
+	virtual FQuestEventMask GetSubscribedQuestEvents() const override { return Super::GetSubscribedQuestEvents() | QuestEventBit(EQuestEvent::WaterRestored); }
 	virtual FText GetTaskText(bool bShowProgress = true) override;
 };
 
@@ -810,6 +847,7 @@ class PATHOFTITANS_API UIQuestWaystoneCooldownTask : public UIQuestItemTask
 public:
 
 	virtual void Update(AIBaseCharacter* QuestOwner, UIQuest* ActiveQuest) override;
+	virtual FQuestEventMask GetSubscribedQuestEvents() const override { return Super::GetSubscribedQuestEvents() | QuestEventBit(EQuestEvent::WaystoneRestored); }
 	virtual FText GetTaskText(bool bShowProgress = true) override;
 };
 
@@ -959,6 +997,12 @@ public:
 
 	virtual void Update(AIBaseCharacter* QuestOwner, UIQuest* ActiveQuest);
 
+	// Like Update, but only for tasks subscribed to one of the events. Returns the number of tasks updated
+	int32 UpdateForQuestEvents(AIBaseCharacter* QuestOwner, FQuestEventMask Events);
+
+	// Events any task of this quest subscribes to
+	FQuestEventMask GetSubscribedQuestEvents() const;
+
 	virtual bool ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch, FReplicationFlags* RepFlags) override;
 
 	virtual void BeginDestroy() override;
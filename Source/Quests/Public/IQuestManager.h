@@ -156,12 +156,123 @@ public:
 	}
 };
 
+// When a cooldown or contribution entry was stamped, kept in a min-heap so ticks only visit entries that are due.
+// An invalid CharacterID stands for every entry of the quest stamped at that time.
+struct FQuestExpiry
+{
+	float Timestamp = 0.0f;
+	FPrimaryAssetId QuestId;
+	FAlderonUID CharacterID = FAlderonUID(-1);
+
+	FQuestExpiry() = default;
+
+	FQuestExpiry(float InTimestamp, const FPrimaryAssetId& InQuestId, const FAlderonUID& InCharacterID = FAlderonUID(-1))
+		: Timestamp(InTimestamp)
+		, QuestId(InQuestId)
+		, CharacterID(InCharacterID)
+	{
+	}
+
+	bool operator<(const FQuestExpiry& Other) const { return Timestamp < Other.Timestamp; }
+};
+
 class AIBaseCharacter;
 class AICritterPawn;
 class AIPlayerGroupActor;
 class UIQuest;
 class UIQuestBaseTask;
+class UIQuestKillTask;
 class UQuestData;
+class UAbilitySystemComponent;
+class APlayerState;
+struct FOnAttributeChangeData;
+
+// A player state and the character whose quests a quest tick updates, the player state may be null
+using FQuestTickParticipant = TPair<const APlayerState*, AIBaseCharacter*>;
+
+// An attribute whose changes publish EQuestEvent::StatChanged for the character holding a stat task
+struct FQuestStatWatchKey
+{
+	TObjectKey<UAbilitySystemComponent> AbilitySystem;
+	FGameplayAttribute Attribute;
+	TObjectKey<AIBaseCharacter> Subscriber;
+
+	bool operator==(const FQuestStatWatchKey& Other) const
+	{
+		return AbilitySystem == Other.AbilitySystem && Attribute == Other.Attribute && Subscriber == Other.Subscriber;
+	}
+
+	friend uint32 GetTypeHash(const FQuestStatWatchKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.AbilitySystem), GetTypeHash(Key.Attribute)), GetTypeHash(Key.Subscriber));
+	}
+};
+
+struct FQuestStatWatch
+{
+	TWeakObjectPtr<UAbilitySystemComponent> AbilitySystem;
+	FDelegateHandle Handle;
+
+	// Fallback sweep that last found a task needing this watch
+	uint32 SweepId = 0;
+};
+
+// A kill task waiting on a victim, Order keeps the active quest / task order the kill is awarded in
+struct FQuestKillTaskRef
+{
+	TWeakObjectPtr<UIQuest> Quest;
+	TWeakObjectPtr<UIQuestKillTask> Task;
+	int32 Order = 0;
+};
+
+// Kill tasks of one character keyed by what they can be advanced by
+struct FQuestKillTaskIndex
+{
+	TMap<FPrimaryAssetId, TArray<FQuestKillTaskRef>> ByCharacterAssetId;
+
+	// Tasks that ignore character asset ids and count any victim of a diet
+	TMap<EDietaryRequirements, TArray<FQuestKillTaskRef>> ByDiet;
+
+	// Hash of the active quests the index was built from
+	uint32 QuestsSignature = 0;
+	bool bBuilt = false;
+};
+
+// Enabled quests a random quest is drawn from, sorted by growth requirement so growth gating is a prefix
+struct FQuestAssetPoolSlice
+{
+	TArray<FPrimaryAssetId> QuestIds;
+	TArray<float> GrowthRequirements;
+	TArray<TWeakObjectPtr<UQuestData>> QuestData;
+};
+
+// Quest asset ids matching one EQuestFilter, with everything that doesn't depend on the player filtered out ahead of time
+struct FQuestAssetPool
+{
+	// Every quest of the filter, as GetLoadedQuestAssetIDsFromType lists them
+	TArray<FPrimaryAssetId> QuestIds;
+
+	// Every enabled quest, for characters without quest tags
+	FQuestAssetPoolSlice Drawable;
+
+	// The enabled quests again split by quest tag, untagged ones under NAME_QuestTagNone
+	TMap<FName, FQuestAssetPoolSlice> DrawableByTag;
+};
+
+class AIGameSession;
+class AIGameState;
+
+// Per player state of one random quest draw, shared by every candidate checked
+struct FRandomQuestDraw
+{
+	AIGameSession* Session = nullptr;
+	AIGameState* IGameState = nullptr;
+	FVector CharacterLocation = FVector::ZeroVector;
+
+	// Exploration quest with a POI in range, handed out to personal draws when nothing else qualifies
+	FPrimaryAssetId ClosestPOIQuest;
+	int32 ClosestPOIDistance = 99999999;
+};
 
 UCLASS()
 class PATHOFTITANS_API AIQuestManager : public AActor
@@ -188,6 +299,26 @@ public:
 
 protected:
 	void QuestTick();
+
+	// Dispatches the pending quest events to the participants' quests, every few ticks as a full fallback sweep
+	void TickQuests(TConstArrayView<FQuestTickParticipant> Participants);
+
+	// Updates the character's quests for the published events, Refresh re-checks everything like the old once a second tick
+	void TickCharacterQuests(const APlayerState* PlayerState, AIBaseCharacter* OwningCharacter, FQuestEventMask Events, AIPlayerGroupActor*& FeedMemberCleanupGroupActor, UIQuest*& FeedMemberQuestToCleanup);
+
+	bool MeetsQuestRequiredTags(AIBaseCharacter* Character, const UQuestData* QuestData) const;
+
+	// Binds attribute change delegates for the quest's stat tasks so they are updated when the stat actually changes
+	void WatchQuestStats(AIBaseCharacter* OwningCharacter, const UIQuest* Quest);
+	void OnWatchedQuestStatChanged(const FOnAttributeChangeData& ChangeData, TWeakObjectPtr<AIBaseCharacter> Subscriber);
+	void PruneQuestStatWatches();
+
+	// Kill task index of the character, rebuilt whenever its active quests changed since the last kill
+	FQuestKillTaskIndex& GetKillTaskIndex(AIBaseCharacter* Character);
+
+	// First kill task in active quest order that the victim advances
+	UIQuestKillTask* FindKillTaskForVictim(AIBaseCharacter* Killer, const AIBaseCharacter* Victim, UIQuest*& OutQuest);
+
 	void QuestTock();
 	void OnQuestTock(AIBaseCharacter* OwningCharacter, FPrimaryAssetId QuestAssetId);
 	void ContributionTick();
@@ -198,13 +329,51 @@ protected:
 	FTimerHandle TimerHandle_ContributionTick;
 	FTimerHandle TimerHandle_CooldownTick;
 
+	// Events published since the last quest tick
+	TMap<TObjectKey<AIBaseCharacter>, FQuestEventMask> PendingQuestEvents;
+	FQuestEventMask PendingGlobalQuestEvents = 0;
+
+	int32 QuestTicksSinceSweep = 0;
+
+	TMap<FQuestStatWatchKey, FQuestStatWatch> QuestStatWatches;
+	uint32 QuestStatSweepId = 0;
+
+	TMap<TObjectKey<AIBaseCharacter>, FQuestKillTaskIndex> KillTaskIndices;
+
+	// Stamped contributions and cooldowns by time, entries whose stamp changed since are skipped when popped
+	TArray<FQuestExpiry> ContributionExpiries;
+	TArray<FQuestExpiry> GroupMeetCooldownExpiries;
+	TArray<FQuestExpiry> GroupQuestCooldownExpiries;
+	TArray<FQuestExpiry> TrophyCooldownExpiries;
+
+	void TrackContributionExpiry(const FPrimaryAssetId& QuestId, float Timestamp);
+	void AddGroupMeetQuestCooldown(const FQuestCooldown& Cooldown);
+	void AddTrophyQuestCooldown(const FQuestCooldown& Cooldown);
+
+	// Drops expired local world quest cooldowns off every player without collecting the ones left
+	void PruneLocalWorldQuestCooldowns();
+
 public:
 
+	// The next quest tick updates the character's tasks subscribed to this event
+	void PublishQuestEvent(AIBaseCharacter* Character, EQuestEvent Event);
+
+	// For world state any player's tasks can depend on, such as water quality
+	void PublishGlobalQuestEvent(EQuestEvent Event);
+
+	// Compares the once a second refresh of every quest with event dispatch through the real quest tick,
+	// for 200 off-map characters of TemplateCharacter's class with 10 quests each
+	FString BenchmarkQuestDispatch(int32 NumSeconds, AIBaseCharacter* TemplateCharacter);
+
 	bool IsPoiCompatibleForExploration(AActor* Poi, AIBaseCharacter* Character) const;
 
 	void GetRandomQuest(AIBaseCharacter* Character, FQuestIDLoaded QuestIDLoaded, EQuestShareType PreferredType = EQuestShareType::Unknown);
 	bool HasRoomForQuest(const AIBaseCharacter* Character, const EQuestShareType PreferredType, EQuestType& ActivePersonalQuestType);
 	void OnGetRandomQuest(AIBaseCharacter* Character, EQuestShareType PreferredType, EQuestType ActivePersonalQuestType, TArray<FPrimaryAssetId> Quests, FQuestIDLoaded QuestIDLoaded);
+
+	// Checks that depend on the player or the world for one random quest candidate, QuestData is loaded if null
+	bool IsRandomQuestEligible(AIBaseCharacter* Character, EQuestShareType PreferredType, EQuestType ActivePersonalQuestType, const FPrimaryAssetId& RandomQuestSelection, UQuestData* QuestData, FRandomQuestDraw& Draw);
+	bool BeginRandomQuestDraw(AIBaseCharacter* Character, FRandomQuestDraw& OutDraw);
 	void GetRandomGroupQuest(AIPlayerGroupActor* PlayerGroupActor, FQuestIDLoaded QuestIDLoaded);
 	void OnGetRandomGroupQuest(EQuestFilter QuestFilter, TArray<FPrimaryAssetId> Quests, AIPlayerGroupActor* PlayerGroupActor, FQuestIDLoaded QuestIDLoaded, float MinGrowthInGroup, TArray<FName, TInlineAllocator<3>> QuestTags);
 	void GetLocalWorldQuests(AIBaseCharacter* Character, FQuestsDataLoaded OnLoadAssetsDelegate);
@@ -275,6 +444,10 @@ public:
 	UIQuest* LoadQuest(AIBaseCharacter* Character, const FQuestSave& QuestSave, bool bMapHasChanged, bool IsActiveQuest);
 	void LoadQuests(AIBaseCharacter* Character, bool bMapHasChanged = false);
 	static void SaveQuest(AIBaseCharacter* Character);
+
+	// Serializes the character's quests without touching the character, so it can run off the game thread while the quests can't change
+	static void SerializeQuests(const AIBaseCharacter* Character, TArray<FQuestSave>& OutQuestSaves, TArray<FQuestSave>& OutUncollectedRewardQuestSaves);
+
 	void ResetQuest(AIBaseCharacter* TargetCharacter, UIQuest* QuestToReset);
 
 	void OnQuestRefresh(AIBaseCharacter* TargetCharacter, UIQuest* TargetQuest);
@@ -441,6 +614,13 @@ public:
 
 	void OnLoadedQuestAssetIDsFromType(TArray<UQuestData*> QuestsData, EQuestFilter QuestFilter, const AIBaseCharacter* Character, FQuestsIDsLoaded OnLoadAssetsDelegate);
 
+	// Drops the cached quest pools, call whenever the quest lists are reloaded (e.g. after mods change)
+	void InvalidateQuestAssetPools();
+
+	// Draws random indices from the cached pool without building a candidate list, only checking the drawn quests against the character.
+	// Returns false if the pools aren't built yet
+	bool DrawRandomQuestFromPool(EQuestFilter QuestFilter, AIBaseCharacter* Character, EQuestShareType PreferredType, EQuestType ActivePersonalQuestType, FQuestIDLoaded QuestIDLoaded);
+
 	UFUNCTION(BlueprintCallable, BlueprintPure)
 	TArray<FPrimaryAssetId> ConvertObjectsToAssets(TArray<UObject*> QuestObjects) const;
 
@@ -479,6 +659,22 @@ public:
 	TArray<FPrimaryAssetId> GroupMeetQuests;
 	TArray<FPrimaryAssetId> GroupSurvivalQuests;
 
+protected:
+
+	void BuildQuestAssetPools();
+	const FQuestAssetPoolSlice* FindUniqueQuests(EQuestFilter QuestFilter, const AIBaseCharacter* Character) const;
+
+	// Built once the quest lists above are filled, indexed by EQuestFilter
+	TArray<FQuestAssetPool> QuestAssetPools;
+
+	// Dinosaur unique quests keyed by the character asset they are restricted to
+	TMap<FPrimaryAssetId, FQuestAssetPoolSlice> SingleUniqueQuestsByCharacter;
+	TMap<FPrimaryAssetId, FQuestAssetPoolSlice> MultiUniqueQuestsByCharacter;
+
+	bool bQuestAssetPoolsValid = false;
+
+public:
+
 	UPROPERTY(BlueprintReadOnly, Category = QuestManager)
 	TArray<FName> ActiveWaterRestorationQuestTags;
 
@@ -10,6 +10,7 @@
 #include "Player/ISpectatorPawn.h"
 #include "Player/Dinosaurs/IDinosaurCharacter.h"
 #include "Misc/ScopeExit.h"
+#include "Async/ParallelFor.h"
 #include "World/IPlayerStart.h"
 #include "World/ICharSelectPoint.h"
 #include "IWorldSettings.h"
@@ -32,6 +33,7 @@
 #include "Components/ICreatorModeObjectComponent.h"
 #include "Net/IVoiceSubsystem.h"
 #include "HttpManager.h"
+#include "Online/WebhookDispatcher.h"
 #include "Online/IPlayerGroupActor.h"
 #include "Components/ICharacterMovementComponent.h"
 #include "CaveSystem/IPlayerCaveBase.h"
@@ -56,6 +58,11 @@
 
 static const FName NAME_HandleSpawnCharacter(TEXT("HandleSpawnCharacter"));
 
+DECLARE_STATS_GROUP(TEXT("SaveQueue"), STATGROUP_SaveQueue, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Queued High Priority Saves"), STAT_SaveQueueHigh, STATGROUP_SaveQueue);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Queued Medium Priority Saves"), STAT_SaveQueueMedium, STATGROUP_SaveQueue);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Queued Low Priority Saves"), STAT_SaveQueueLow, STATGROUP_SaveQueue);
+
 AIGameMode::AIGameMode(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	// Assign the class types used by this game mode 
@@ -78,6 +85,9 @@ AIGameMode::AIGameMode(const FObjectInitializer& ObjectInitializer) : Super(Obje
 
 	bUseSeamlessTravel = true;
 
+	// Dispatches queued saves
+	PrimaryActorTick.bCanEverTick = true;
+
 	FString EdgegapContextUrl = FPlatformMisc::GetEnvironmentVariable(TEXT("ARBITRIUM_CONTEXT_URL"));
 	EdgegapContextUrl.TrimQuotesInline();
 
@@ -734,21 +744,55 @@ void AIGameMode::AddInactivePlayer(APlayerState* PlayerState, APlayerController*
 
 bool AIGameMode::SaveAllPlayers()
 {
-//#if !WITH_EDITOR
-//	// Search for all players
-//	TArray<AActor*> FoundPlayers;
-//	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AIPlayerController::StaticClass(), FoundPlayers);
-//	
-//	// Cast from Actor and save all players
-//	for (AActor* Actor : FoundPlayers)
-//	{
-//		AIPlayerController* PC = Cast<AIPlayerController>(Actor);
-//		if (PC && PC->IsValidLowLevel())
-//		{
-//			SaveCharacter(PC);
-//		}
-//	}
-//#endif
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameMode::SaveAllPlayers"))
+
+	if (!DatabaseEngine)
+	{
+		return false;
+	}
+
+	struct FPlayerSaveSnapshot
+	{
+		AIPlayerController* PlayerController = nullptr;
+		AIBaseCharacter* Character = nullptr;
+		FAsyncOperationCompleted OnCompleted;
+		TArray<FQuestSave> QuestSaves;
+		TArray<FQuestSave> UncollectedRewardQuestSaves;
+	};
+
+	// Game thread: every possessed character, taking over its queued save so it is only written once
+	TArray<FPlayerSaveSnapshot> Snapshots;
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		AIPlayerController* const IPlayerController = Cast<AIPlayerController>(*Iterator);
+		AIBaseCharacter* const IBaseCharacter = IsValid(IPlayerController) ? Cast<AIBaseCharacter>(IPlayerController->GetPawn()) : nullptr;
+		if (!IsValid(IBaseCharacter) || !IsValid(IPlayerController->PlayerState))
+		{
+			continue;
+		}
+
+		FPlayerSaveSnapshot& Snapshot = Snapshots.AddDefaulted_GetRef();
+		Snapshot.PlayerController = IPlayerController;
+		Snapshot.Character = IBaseCharacter;
+		Snapshot.OnCompleted = TakeOverQueuedSave(IBaseCharacter, FAsyncOperationCompleted());
+	}
+
+	// Workers: the quests are serialized to json in parallel. The game thread waits here, so nothing changes them while they are read.
+	ParallelFor(Snapshots.Num(), [&Snapshots](int32 Index)
+	{
+		FPlayerSaveSnapshot& Snapshot = Snapshots[Index];
+		AIQuestManager::SerializeQuests(Snapshot.Character, Snapshot.QuestSaves, Snapshot.UncollectedRewardQuestSaves);
+	});
+
+	// Game thread: hand the characters and their player states to the database layer
+	for (FPlayerSaveSnapshot& Snapshot : Snapshots)
+	{
+		Snapshot.Character->QuestSaves = MoveTemp(Snapshot.QuestSaves);
+		Snapshot.Character->UncollectedRewardQuestSaves = MoveTemp(Snapshot.UncollectedRewardQuestSaves);
+
+		SaveQueueDispatched[GetSaveQueueIndex(ESavePriority::Medium)]++;
+		DispatchSaveAll(Snapshot.PlayerController, Snapshot.OnCompleted, ESavePriority::Medium, true);
+	}
 
 	return true;
 }
@@ -913,6 +957,62 @@ float AIGameMode::GetDistanceToClosestPlayer(FVector TargetLocation)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameMode::GetDistanceToClosestPlayer"))
 
+	return GetPlayerPositionGrid().FindNearestDistance(TargetLocation);
+}
+
+const FPlayerPositionGrid& AIGameMode::GetPlayerPositionGrid()
+{
+	if (PlayerPositionGridFrame != GFrameCounter)
+	{
+		RefreshPlayerPositionGrid();
+	}
+
+	return PlayerPositionGrid;
+}
+
+void AIGameMode::RefreshPlayerPositionGrid()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameMode::RefreshPlayerPositionGrid"))
+
+	const AIGameState* const IGameState = GetGameState<AIGameState>();
+	check(IGameState);
+
+	PlayerPositionGridFrame = GFrameCounter;
+	PlayerPositionGrid.SetCellSize(PlayerPositionGridCellSize);
+	PlayerPositionGrid.Reset();
+
+	for (const APlayerState* PlayerState : IGameState->PlayerArray)
+	{
+		if (!PlayerState)
+		{
+			continue;
+		}
+
+		const APawn* const ControlledPawn = PlayerState->GetPawn();
+		if (!ControlledPawn)
+		{
+			continue;
+		}
+
+		PlayerPositionGrid.Add(ControlledPawn->GetActorLocation());
+	}
+
+	for (const TPair<FAlderonUID, AIBaseCharacter*>& CombatLogPair : CombatLogAI)
+	{
+		const AIBaseCharacter* const CombatLogCharacter = CombatLogPair.Value;
+		if (!CombatLogCharacter)
+		{
+			continue;
+		}
+
+		PlayerPositionGrid.Add(CombatLogCharacter->GetActorLocation());
+	}
+}
+
+float AIGameMode::GetDistanceToClosestPlayerLinear(const FVector& TargetLocation) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameMode::GetDistanceToClosestPlayerLinear"))
+
 	const AIGameState* const IGameState = GetGameState<AIGameState>();
 	check(IGameState);
 
@@ -958,19 +1058,89 @@ float AIGameMode::GetDistanceToClosestPlayer(FVector TargetLocation)
 	return DistanceToPlayer;
 }
 
+FString AIGameMode::BenchmarkPlayerPositionGrid(int32 Iterations)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameMode::BenchmarkPlayerPositionGrid"))
+
+	Iterations = FMath::Max(Iterations, 1);
+
+	TArray<FVector> SpawnLocations = GenericSpawnPoints;
+	SpawnLocations.Reserve(SpawnLocations.Num() + CustomSpawnPoints.Num());
+	for (const APlayerStart* PlayerStart : CustomSpawnPoints)
+	{
+		if (PlayerStart)
+		{
+			SpawnLocations.Add(PlayerStart->GetActorLocation());
+		}
+	}
+
+	// Force a rebuild so its cost is included in the grid timing.
+	PlayerPositionGridFrame = MAX_uint64;
+
+	int32 Mismatches = 0;
+
+	const double LinearStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		for (const FVector& SpawnLocation : SpawnLocations)
+		{
+			GetDistanceToClosestPlayerLinear(SpawnLocation);
+		}
+	}
+	const double LinearSeconds = FPlatformTime::Seconds() - LinearStart;
+
+	const double GridStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		for (const FVector& SpawnLocation : SpawnLocations)
+		{
+			GetDistanceToClosestPlayer(SpawnLocation);
+		}
+	}
+	const double GridSeconds = FPlatformTime::Seconds() - GridStart;
+
+	for (const FVector& SpawnLocation : SpawnLocations)
+	{
+		if (!FMath::IsNearlyEqual(GetDistanceToClosestPlayerLinear(SpawnLocation), GetDistanceToClosestPlayer(SpawnLocation), 1.0f))
+		{
+			Mismatches++;
+		}
+	}
+
+	const FString Summary = FString::Printf(TEXT("PlayerPositionGrid: %d spawn points, %d players, %d iterations. Linear: %.3fms Grid: %.3fms Mismatches: %d"),
+		SpawnLocations.Num(), PlayerPositionGrid.Num(), Iterations, LinearSeconds * 1000.0, GridSeconds * 1000.0, Mismatches);
+
+	UE_LOG(TitansNetwork, Log, TEXT("AIGameMode::BenchmarkPlayerPositionGrid: %s"), *Summary);
+
+	return Summary;
+}
+
 FTransform AIGameMode::FindRandomSpawnPointWithParams_Implementation(const FSpawnPointParameters& Params)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameMode::FindRandomSpawnPointForTag"))
 
 	const bool bUseRandomMethod = ShouldUseRandomSpawnPoint();
 
-	FName SpawnTag = NAME_None;
-	if (!Params.TargetTags.IsEmpty())
+	// Use the first tag that maps to any spawn points, falling back through the remaining tags.
+	const TArray<APlayerStart*>* SpawnPointsMatchingTagPtr = nullptr;
+	bool bHasSpawnTag = false;
+
+	for (const FName& SpawnTag : Params.TargetTags)
 	{
-		SpawnTag = Params.TargetTags[0];
+		bHasSpawnTag = SpawnTag != NAME_None;
+		if (!bHasSpawnTag)
+		{
+			break;
+		}
+
+		SpawnPointsMatchingTagPtr = FindSpawnPointsWithTag(SpawnTag);
+		if (SpawnPointsMatchingTagPtr)
+		{
+			break;
+		}
 	}
 
-	if (SpawnTag == NAME_None)
+	if (!bHasSpawnTag)
 	{
 		// No spawn tag so just find a random spawn point.
 
@@ -989,23 +1159,15 @@ FTransform AIGameMode::FindRandomSpawnPointWithParams_Implementation(const FSpaw
 		return Result;
 	}
 
-	const TArray<APlayerStart*> SpawnPointsMatchingTag = GetSpawnPointsWithTag(SpawnTag);
-
-	if (SpawnPointsMatchingTag.IsEmpty())
+	if (!SpawnPointsMatchingTagPtr)
 	{
-		// No spawn points with the specified tag, so try the next tag.
-		if (Params.TargetTags.IsValidIndex(1))
-		{
-			FSpawnPointParameters FallbackParams = Params;
-			FallbackParams.TargetTags.RemoveAt(0);
-			return FindRandomSpawnPointWithParams(FallbackParams);
-		}
-
 		// No valid spawn points for any tag and no spawn points without players nearby.
 		// Return the spawn point with less players nearby.
 		return FindGenericSpawnPointWithLessPlayersNearby();
 	}
 
+	const TArray<APlayerStart*>& SpawnPointsMatchingTag = *SpawnPointsMatchingTagPtr;
+
 	if (bUseRandomMethod)
 	{
 		const int32 RandomSpawnIndex = FMath::RandRange(0, SpawnPointsMatchingTag.Num() - 1);
@@ -1148,35 +1310,24 @@ FTransform AIGameMode::FindGenericSpawnPointWithLessPlayersNearby_Implementation
 		return FTransform::Identity;
 	}
 
-	UWorld* World = GetWorld();
-	if (!World)
-	{
-		UE_LOG(TitansNetwork, Error, TEXT("AIGameMode::FindRandomGenericSpawnPoint_Implementation: UWorld is null"));
-		return FTransform::Identity;
-	}
+	const FPlayerPositionGrid& PositionGrid = GetPlayerPositionGrid();
 
-	FVector SelectedSpawnPoint;
+	FVector SelectedSpawnPoint = GenericSpawnPoints[0];
 	int32 MinPlayersInExclusionRadius = MAX_int32;
-	TArray<FHitResult> OutHits{};
-	ECollisionChannel TraceChannel = ECC_Pawn;
-	FCollisionQueryParams TraceParams;
 	
-	for (const FVector SpawnPoint : GenericSpawnPoints)
+	for (const FVector& SpawnPoint : GenericSpawnPoints)
 	{
-		World->SweepMultiByChannel(OutHits, SpawnPoint, SpawnPoint, FQuat(), TraceChannel, FCollisionShape::MakeSphere(PotentialSpawnExclusionRadius), TraceParams);
-		int32 PlayersInExclusionRadius = 0;
-
-		for (FHitResult Hit : OutHits)
-		{
-			if (Hit.GetActor()->IsA(AIDinosaurCharacter::StaticClass()))
-			{
-				PlayersInExclusionRadius++;
-			}
-		}
+		const int32 PlayersInExclusionRadius = PositionGrid.CountInRadius(SpawnPoint, PotentialSpawnExclusionRadius);
 
 		if (PlayersInExclusionRadius < MinPlayersInExclusionRadius)
 		{
+			MinPlayersInExclusionRadius = PlayersInExclusionRadius;
 			SelectedSpawnPoint = SpawnPoint;
+
+			if (PlayersInExclusionRadius == 0)
+			{
+				break;
+			}
 		}
 	}
 
@@ -1227,7 +1378,7 @@ bool AIGameMode::ValidatePotentialSpawnPoint(const APlayerStart* PlayerStart, co
 		return false;
 	}
 
-	if (GetDistanceToClosestPlayer(PlayerStartLocation) <= PotentialSpawnExclusionRadius)
+	if (GetPlayerPositionGrid().AnyInRadius(PlayerStartLocation, PotentialSpawnExclusionRadius))
 	{
 		return false;
 	}
@@ -1235,33 +1386,197 @@ bool AIGameMode::ValidatePotentialSpawnPoint(const APlayerStart* PlayerStart, co
 	return true;
 }
 
+namespace
+{
+	void GetSpawnPointTags(const APlayerStart* PlayerStart, TArray<FName, TInlineAllocator<8>>& OutTags)
+	{
+		OutTags.Reset();
+
+		if (PlayerStart->PlayerStartTag != NAME_None)
+		{
+			OutTags.Add(PlayerStart->PlayerStartTag);
+		}
+
+		if (const AIPlayerStart* const IPlayerStart = Cast<AIPlayerStart>(PlayerStart))
+		{
+			for (const FName& Tag : IPlayerStart->AnyPlayerStartTags)
+			{
+				OutTags.AddUnique(Tag);
+			}
+		}
+	}
+}
+
 TArray<APlayerStart*> AIGameMode::GetSpawnPointsWithTag(FName SpawnTag) const
 {
-	TArray<APlayerStart*> Result{};
-	Result.Reserve(CustomSpawnPoints.Num());
+	if (const TArray<APlayerStart*>* const SpawnPoints = FindSpawnPointsWithTag(SpawnTag))
+	{
+		return *SpawnPoints;
+	}
+
+	return TArray<APlayerStart*>();
+}
+
+const TArray<APlayerStart*>* AIGameMode::FindSpawnPointsWithTag(FName SpawnTag) const
+{
+	const TArray<APlayerStart*>* const SpawnPoints = SpawnPointTagIndex.Find(SpawnTag);
+	return (SpawnPoints && !SpawnPoints->IsEmpty()) ? SpawnPoints : nullptr;
+}
+
+void AIGameMode::RebuildSpawnPointTagIndex()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameMode::RebuildSpawnPointTagIndex"))
+
+	SpawnPointTagIndex.Reset();
+	SpawnPointIndexedTags.Reset();
 
 	for (APlayerStart* PlayerStart : CustomSpawnPoints)
 	{
-		if (!PlayerStart)
+		if (IsValid(PlayerStart))
 		{
-			continue;
+			AddSpawnPointToTagIndex(PlayerStart);
+			PlayerStart->OnDestroyed.AddUniqueDynamic(this, &AIGameMode::OnSpawnPointDestroyed);
 		}
+	}
+}
+
+void AIGameMode::AddSpawnPointToTagIndex(APlayerStart* PlayerStart)
+{
+	if (!PlayerStart)
+	{
+		return;
+	}
+
+	TArray<FName, TInlineAllocator<8>> Tags;
+	GetSpawnPointTags(PlayerStart, Tags);
+
+	TArray<FName, TInlineAllocator<4>>& IndexedTags = SpawnPointIndexedTags.FindOrAdd(PlayerStart);
+	for (const FName& Tag : Tags)
+	{
+		SpawnPointTagIndex.FindOrAdd(Tag).AddUnique(PlayerStart);
+		IndexedTags.AddUnique(Tag);
+	}
+}
+
+void AIGameMode::RemoveSpawnPointFromTagIndex(APlayerStart* PlayerStart)
+{
+	// Tags may have changed since the spawn point was indexed, remove it under the ones it was indexed with.
+	TArray<FName, TInlineAllocator<4>> IndexedTags;
+	if (!SpawnPointIndexedTags.RemoveAndCopyValue(PlayerStart, IndexedTags))
+	{
+		return;
+	}
 
-		if (PlayerStart->PlayerStartTag == SpawnTag)
+	for (const FName& Tag : IndexedTags)
+	{
+		TArray<APlayerStart*>* const SpawnPoints = SpawnPointTagIndex.Find(Tag);
+		if (!SpawnPoints)
 		{
-			Result.Add(PlayerStart);
 			continue;
 		}
 
-		AIPlayerStart* const IPlayerStart = Cast<AIPlayerStart>(PlayerStart);
-		if (IPlayerStart && IPlayerStart->AnyPlayerStartTags.Contains(SpawnTag))
+		SpawnPoints->RemoveSingleSwap(PlayerStart, false);
+
+		if (SpawnPoints->IsEmpty())
 		{
-			Result.Add(PlayerStart);
-			continue;
+			SpawnPointTagIndex.Remove(Tag);
 		}
 	}
+}
+
+void AIGameMode::RegisterSpawnPoint(APlayerStart* PlayerStart)
+{
+	if (!IsValid(PlayerStart) || CustomSpawnPoints.Contains(PlayerStart))
+	{
+		return;
+	}
 
-	return Result;
+	TArray<FName, TInlineAllocator<8>> Tags;
+	GetSpawnPointTags(PlayerStart, Tags);
+
+	if (Tags.IsEmpty())
+	{
+		return;
+	}
+
+	if (const AIWorldSettings* const IWorldSettings = Cast<AIWorldSettings>(GetWorldSettings()))
+	{
+		if (!IWorldSettings->IsInWorldBounds(PlayerStart->GetActorLocation()))
+		{
+			UE_LOG(LogTemp, Error, TEXT("AIGameMode::RegisterSpawnPoint: Spawn point out of bounds."));
+			return;
+		}
+	}
+
+	CustomSpawnPoints.Add(PlayerStart);
+	AddSpawnPointToTagIndex(PlayerStart);
+
+	if (Tags.Contains(NAME_Land))
+	{
+		GenericSpawnPoints.Add(PlayerStart->GetActorLocation());
+	}
+
+	PlayerStart->OnDestroyed.AddUniqueDynamic(this, &AIGameMode::OnSpawnPointDestroyed);
+}
+
+void AIGameMode::UnregisterSpawnPoint(APlayerStart* PlayerStart)
+{
+	if (!PlayerStart || CustomSpawnPoints.RemoveSingleSwap(PlayerStart, false) == 0)
+	{
+		return;
+	}
+
+	RemoveSpawnPointFromTagIndex(PlayerStart);
+	GenericSpawnPoints.RemoveSingleSwap(PlayerStart->GetActorLocation(), false);
+
+	PlayerStart->OnDestroyed.RemoveDynamic(this, &AIGameMode::OnSpawnPointDestroyed);
+}
+
+void AIGameMode::RefreshSpawnPointTags(APlayerStart* PlayerStart)
+{
+	UnregisterSpawnPoint(PlayerStart);
+	RegisterSpawnPoint(PlayerStart);
+}
+
+void AIGameMode::OnActorSpawned(AActor* SpawnedActor)
+{
+#if WITH_EDITOR
+	if (Cast<APlayerStartPIE>(SpawnedActor))
+	{
+		return;
+	}
+#endif
+
+	APlayerStart* const PlayerStart = Cast<APlayerStart>(SpawnedActor);
+	if (!PlayerStart)
+	{
+		return;
+	}
+
+	// Spawn tags are set after SpawnActor returns, or before FinishSpawning for deferred spawns, so index the spawn point once it has them
+	GetWorldTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this, WeakPlayerStart = TWeakObjectPtr<APlayerStart>(PlayerStart)]()
+	{
+		APlayerStart* const SpawnedPlayerStart = WeakPlayerStart.Get();
+		if (!IsValid(SpawnedPlayerStart))
+		{
+			return;
+		}
+
+		if (SpawnedPlayerStart->IsActorInitialized())
+		{
+			RegisterSpawnPoint(SpawnedPlayerStart);
+		}
+		else
+		{
+			// Deferred spawn that hasn't finished yet
+			OnActorSpawned(SpawnedPlayerStart);
+		}
+	}));
+}
+
+void AIGameMode::OnSpawnPointDestroyed(AActor* DestroyedActor)
+{
+	UnregisterSpawnPoint(Cast<APlayerStart>(DestroyedActor));
 }
 
 void AIGameMode::FinishCreatingCharacter(AIPlayerController* PlayerController, UCharacterDataAsset* CharacterDataAsset, USkinDataAsset* SkinDataAsset, FCharacterData CharacterData, TSharedPtr<FStreamableHandle> Handle, FAsyncCharacterCreated OnCreateCompleted)
@@ -3849,7 +4164,7 @@ void AIGameMode::SaveCombatLogAI(AIBaseCharacter* TargetCombatLogAI, bool bDestr
 	SaveCharacterAsync(TargetCombatLogAI, OnCombatLogSaved, ESavePriority::Low);
 }
 
-void AIGameMode::PrepareCharacterForSave(AIBaseCharacter* TargetCharacter)
+void AIGameMode::PrepareCharacterForSave(AIBaseCharacter* TargetCharacter, const bool bQuestsSerialized)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameMode::PrepareCharacterForSave"))
 
@@ -3908,7 +4223,10 @@ void AIGameMode::PrepareCharacterForSave(AIBaseCharacter* TargetCharacter)
 	TargetCharacter->PrepareGameplayEffectsForSave();
 
 	// Handle Quest Saving
-	AIQuestManager::SaveQuest(TargetCharacter);
+	if (!bQuestsSerialized)
+	{
+		AIQuestManager::SaveQuest(TargetCharacter);
+	}
 }
 
 void AIGameMode::SaveCharacter(AIBaseCharacter* TargetCharacter, const ESavePriority Priority)
@@ -3916,7 +4234,7 @@ void AIGameMode::SaveCharacter(AIBaseCharacter* TargetCharacter, const ESavePrio
 	SaveCharacterAsync(TargetCharacter, FAsyncOperationCompleted(), Priority);
 }
 
-void AIGameMode::SaveCharacterAsync(AIBaseCharacter* TargetCharacter, FAsyncOperationCompleted OnCompleted, const ESavePriority Priority)
+void AIGameMode::SaveCharacterAsync(AIBaseCharacter* TargetCharacter, FAsyncOperationCompleted OnCompleted, const ESavePriority Priority, const bool bQuestsSerialized)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameMode::SaveCharacterAsync"))
 
@@ -3926,7 +4244,7 @@ void AIGameMode::SaveCharacterAsync(AIBaseCharacter* TargetCharacter, FAsyncOper
 	{
 		TargetCharacter->LastPlayedDate = FDateTime::UtcNow();
 
-		PrepareCharacterForSave(TargetCharacter);
+		PrepareCharacterForSave(TargetCharacter, bQuestsSerialized);
 
 		// Determine AlderonId to save Character Under
 		FAlderonPlayerID SaveAlderonId;
@@ -3984,6 +4302,251 @@ void AIGameMode::SaveAllAsync(AIPlayerController* PlayerController, FAsyncOperat
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameMode::SaveAllAsync"))
 
+	AIBaseCharacter* IBaseCharacter = IsValid(PlayerController) ? Cast<AIBaseCharacter>(PlayerController->GetPawn()) : nullptr;
+	if (!IsValid(IBaseCharacter) || !IsValid(PlayerController->PlayerState))
+	{
+		// Nothing to queue, let DispatchSaveAll report the failure
+		DispatchSaveAll(PlayerController, OnCompleted, Priority);
+		return;
+	}
+
+	const FAlderonUID CharacterID = IBaseCharacter->GetCharacterID();
+	FQueuedPlayerSave* QueuedSave = QueuedPlayerSaves.Find(CharacterID);
+
+	// Urgent saves (and anything once shutdown saving has started) can't wait for the queue.
+	// Take over any queued save for the same character so it isn't written twice.
+	if (Priority == ESavePriority::High || bSavedDataForShutdown)
+	{
+		OnCompleted = TakeOverQueuedSave(IBaseCharacter, OnCompleted);
+
+		SaveQueueDispatched[GetSaveQueueIndex(Priority)]++;
+		DispatchSaveAll(PlayerController, OnCompleted, Priority);
+		return;
+	}
+
+	const int32 QueueIndex = GetSaveQueueIndex(Priority);
+
+	if (QueuedSave)
+	{
+		// Coalesce, the queued save will pick up the latest state when it is dispatched
+		QueuedSave->Callbacks.Add(OnCompleted);
+		QueuedSave->PlayerController = PlayerController;
+		SaveQueueCoalesced[QueueIndex]++;
+
+		const int32 OldQueueIndex = GetSaveQueueIndex(QueuedSave->Priority);
+		if (QueueIndex < OldQueueIndex)
+		{
+			SaveQueues[OldQueueIndex].Remove(CharacterID);
+			SaveQueues[QueueIndex].Add(CharacterID);
+			QueuedSave->Priority = Priority;
+		}
+		return;
+	}
+
+	FQueuedPlayerSave& NewSave = QueuedPlayerSaves.Add(CharacterID);
+	NewSave.PlayerController = PlayerController;
+	NewSave.Character = IBaseCharacter;
+	NewSave.Priority = Priority;
+	NewSave.QueuedTime = FPlatformTime::Seconds();
+	NewSave.Callbacks.Add(OnCompleted);
+
+	SaveQueues[QueueIndex].Add(CharacterID);
+
+	IBaseCharacter->OnDestroyed.AddUniqueDynamic(this, &AIGameMode::OnQueuedSaveCharacterDestroyed);
+}
+
+FAsyncOperationCompleted AIGameMode::TakeOverQueuedSave(AIBaseCharacter* IBaseCharacter, FAsyncOperationCompleted OnCompleted)
+{
+	const FAlderonUID CharacterID = IBaseCharacter->GetCharacterID();
+
+	FQueuedPlayerSave* const QueuedSave = QueuedPlayerSaves.Find(CharacterID);
+	if (!QueuedSave)
+	{
+		return OnCompleted;
+	}
+
+	QueuedSave->Callbacks.Add(OnCompleted);
+	SaveQueues[GetSaveQueueIndex(QueuedSave->Priority)].Remove(CharacterID);
+	SaveQueueCoalesced[GetSaveQueueIndex(QueuedSave->Priority)]++;
+
+	FQueuedPlayerSave TakenSave;
+	QueuedPlayerSaves.RemoveAndCopyValue(CharacterID, TakenSave);
+
+	IBaseCharacter->OnDestroyed.RemoveDynamic(this, &AIGameMode::OnQueuedSaveCharacterDestroyed);
+
+	return CombineSaveCallbacks(MoveTemp(TakenSave.Callbacks));
+}
+
+int32 AIGameMode::GetSaveQueueIndex(const ESavePriority Priority)
+{
+	switch (Priority)
+	{
+	case ESavePriority::High:
+		return 0;
+	case ESavePriority::Medium:
+		return 1;
+	default:
+		return 2;
+	}
+}
+
+FAsyncOperationCompleted AIGameMode::CombineSaveCallbacks(TArray<FAsyncOperationCompleted, TInlineAllocator<1>>&& Callbacks)
+{
+	Callbacks.RemoveAll([](const FAsyncOperationCompleted& Callback)
+	{
+		return !Callback.IsBound();
+	});
+
+	if (Callbacks.IsEmpty())
+	{
+		// Unbound, so DispatchSaveAll doesn't need to chain the character and player state saves
+		return FAsyncOperationCompleted();
+	}
+
+	if (Callbacks.Num() == 1)
+	{
+		return Callbacks[0];
+	}
+
+	return FAsyncOperationCompleted::CreateLambda([Callbacks = MoveTemp(Callbacks)](bool bSuccess)
+	{
+		for (const FAsyncOperationCompleted& Callback : Callbacks)
+		{
+			Callback.ExecuteIfBound(bSuccess);
+		}
+	});
+}
+
+void AIGameMode::FlushSaveQueue()
+{
+	ProcessSaveQueue(true);
+}
+
+void AIGameMode::ProcessSaveQueue(const bool bFlushAll)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameMode::ProcessSaveQueue"))
+
+	if (QueuedPlayerSaves.IsEmpty())
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = SaveQueueFrameBudgetMs / 1000.0;
+	bool bDispatchedAny = false;
+
+	for (int32 QueueIndex = 0; QueueIndex < NumSaveQueues; QueueIndex++)
+	{
+		TArray<FAlderonUID>& Queue = SaveQueues[QueueIndex];
+
+		int32 Index = 0;
+		while (Index < Queue.Num())
+		{
+			// Always make progress, even if a single save is over budget
+			if (!bFlushAll && bDispatchedAny && FPlatformTime::Seconds() - StartTime > BudgetSeconds)
+			{
+				return;
+			}
+
+			const FAlderonUID CharacterID = Queue[Index];
+			const FQueuedPlayerSave& QueuedSave = QueuedPlayerSaves.FindChecked(CharacterID);
+
+			// A write for this character is still in flight, hold the newer save back so it lands after it
+			const bool bWriteInProgress = CharacterSavesInProgress.Contains(CharacterID);
+			if (!bFlushAll && bWriteInProgress && FPlatformTime::Seconds() - QueuedSave.QueuedTime < SaveQueueMaxDeferSeconds)
+			{
+				Index++;
+				continue;
+			}
+
+			Queue.RemoveAt(Index, 1, false);
+
+			FQueuedPlayerSave SaveToDispatch;
+			QueuedPlayerSaves.RemoveAndCopyValue(CharacterID, SaveToDispatch);
+
+			SaveQueueDispatched[QueueIndex]++;
+			DispatchQueuedSave(MoveTemp(SaveToDispatch));
+			bDispatchedAny = true;
+		}
+	}
+}
+
+void AIGameMode::DispatchQueuedSave(FQueuedPlayerSave&& QueuedSave)
+{
+	FAsyncOperationCompleted OnCompleted = CombineSaveCallbacks(MoveTemp(QueuedSave.Callbacks));
+
+	AIPlayerController* const PlayerController = QueuedSave.PlayerController.Get();
+	AIBaseCharacter* const IBaseCharacter = QueuedSave.Character.Get();
+
+	if (IBaseCharacter)
+	{
+		IBaseCharacter->OnDestroyed.RemoveDynamic(this, &AIGameMode::OnQueuedSaveCharacterDestroyed);
+	}
+
+	if (PlayerController && IBaseCharacter && PlayerController->GetPawn() == IBaseCharacter)
+	{
+		DispatchSaveAll(PlayerController, OnCompleted, QueuedSave.Priority);
+	}
+	else if (IsValid(IBaseCharacter))
+	{
+		// The controller moved on to another pawn while this save was queued, still write the queued character
+		SaveCharacterAsync(IBaseCharacter, OnCompleted, QueuedSave.Priority);
+	}
+	else
+	{
+		OnCompleted.ExecuteIfBound(false);
+	}
+}
+
+void AIGameMode::OnQueuedSaveCharacterDestroyed(AActor* DestroyedActor)
+{
+	AIBaseCharacter* const IBaseCharacter = Cast<AIBaseCharacter>(DestroyedActor);
+	if (!IBaseCharacter)
+	{
+		return;
+	}
+
+	const FAlderonUID CharacterID = IBaseCharacter->GetCharacterID();
+
+	FQueuedPlayerSave SaveToDispatch;
+	if (!QueuedPlayerSaves.RemoveAndCopyValue(CharacterID, SaveToDispatch))
+	{
+		return;
+	}
+
+	const int32 QueueIndex = GetSaveQueueIndex(SaveToDispatch.Priority);
+	SaveQueues[QueueIndex].Remove(CharacterID);
+	SaveQueueDispatched[QueueIndex]++;
+
+	// The character isn't garbage until its destroy has been broadcast, so it can still be written like a PreLogout save
+	DispatchQueuedSave(MoveTemp(SaveToDispatch));
+}
+
+FSaveQueueMetrics AIGameMode::GetSaveQueueMetrics(const ESavePriority Priority) const
+{
+	const int32 QueueIndex = GetSaveQueueIndex(Priority);
+
+	FSaveQueueMetrics Metrics;
+	Metrics.Queued = SaveQueues[QueueIndex].Num();
+	Metrics.Coalesced = SaveQueueCoalesced[QueueIndex];
+	Metrics.Dispatched = SaveQueueDispatched[QueueIndex];
+
+	const double Now = FPlatformTime::Seconds();
+	for (const FAlderonUID& CharacterID : SaveQueues[QueueIndex])
+	{
+		if (const FQueuedPlayerSave* const QueuedSave = QueuedPlayerSaves.Find(CharacterID))
+		{
+			Metrics.OldestWaitSeconds = FMath::Max(Metrics.OldestWaitSeconds, static_cast<float>(Now - QueuedSave->QueuedTime));
+		}
+	}
+
+	return Metrics;
+}
+
+void AIGameMode::DispatchSaveAll(AIPlayerController* PlayerController, FAsyncOperationCompleted OnCompleted, const ESavePriority Priority, const bool bQuestsSerialized)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameMode::DispatchSaveAll"))
+
 	//START_PERF_TIME()
 
 	if (!IsValid(PlayerController))
@@ -4036,12 +4599,12 @@ void AIGameMode::SaveAllAsync(AIPlayerController* PlayerController, FAsyncOperat
 
 		//No need to save the Priority passed in as after saving the character the On Complete gets called and will save with the proper priority
 		//Mainly concerned about writing High priority specifically on Switch
-		SaveCharacterAsync(IBaseCharacter, OnCompletedCharacter, ESavePriority::Low);
+		SaveCharacterAsync(IBaseCharacter, OnCompletedCharacter, ESavePriority::Low, bQuestsSerialized);
 	}
 	else
 	{
 		// Complete save together
-		SaveCharacter(IBaseCharacter, ESavePriority::Low);
+		SaveCharacterAsync(IBaseCharacter, FAsyncOperationCompleted(), ESavePriority::Low, bQuestsSerialized);
 		SavePlayerState(IPlayerState, Priority);
 	}
 
@@ -4059,6 +4622,14 @@ void AIGameMode::DeleteNest(AINest* Nest)
 
 void AIGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+	ActorSpawnedHandle.Reset();
+
+	FlushSaveQueue();
+
 	Super::EndPlay(EndPlayReason);
 	ShutdownDatabase();
 }
@@ -4068,6 +4639,19 @@ void AIGameMode::BeginDestroy()
 	Super::BeginDestroy();
 }
 
+void AIGameMode::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	ProcessSaveQueue(false);
+
+#if STATS
+	SET_DWORD_STAT(STAT_SaveQueueHigh, SaveQueues[GetSaveQueueIndex(ESavePriority::High)].Num());
+	SET_DWORD_STAT(STAT_SaveQueueMedium, SaveQueues[GetSaveQueueIndex(ESavePriority::Medium)].Num());
+	SET_DWORD_STAT(STAT_SaveQueueLow, SaveQueues[GetSaveQueueIndex(ESavePriority::Low)].Num());
+#endif
+}
+
 void AIGameMode::StartPlay()
 {
 	Super::StartPlay();
@@ -4169,19 +4753,12 @@ void AIGameMode::InitGame(const FString& MapName, const FString& Options, FStrin
 					if (PS->PlayerStartTag != NAME_None || (IPlayerStart && IPlayerStart->AnyPlayerStartTags.Num() > 0))
 					{
 						CustomSpawnPoints.Add(PS);
-
-						if (IsValid(IPlayerStart))
-						{
-							if (IPlayerStart->AnyPlayerStartTags.Contains(NAME_Land))
-							{
-								GenericSpawnPoints.Add(Actor->GetActorLocation());
-							}
-						}
 	
 						//continue;
 					}
 
-					if (IsValid(PS) && PS->PlayerStartTag == NAME_Land)
+					// Once per start, a Land start can also list Land among its other tags and UnregisterSpawnPoint removes a single copy
+					if (PS->PlayerStartTag == NAME_Land || (IsValid(IPlayerStart) && IPlayerStart->AnyPlayerStartTags.Contains(NAME_Land)))
 					{
 						GenericSpawnPoints.Add(Actor->GetActorLocation());
 						//Actor->Destroy();
@@ -4193,6 +4770,11 @@ void AIGameMode::InitGame(const FString& MapName, const FString& Options, FStrin
 
 			GenericSpawnPoints.Shrink();
 		}
+
+		RebuildSpawnPointTagIndex();
+
+		// Spawn points placed at runtime (creator mode) are indexed as they spawn
+		ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &AIGameMode::OnActorSpawned));
 	}
 
 	bLockingLevelLoadCompleted = true;
@@ -5340,6 +5922,7 @@ void AIGameMode::SaveDataForShutdown()
 	const FString& CharacterDataSaving = FString(TEXT("Saving Character Data for Server Shutdown"));
 
 	UE_LOG(TitansCharacter, Log, TEXT("--------------[SAVING PLAYER DATA]----------------"));
+
 	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
 	{
 		AIPlayerController* IPlayerController = Cast<AIPlayerController>(*Iterator);
@@ -5347,10 +5930,13 @@ void AIGameMode::SaveDataForShutdown()
 		if (!IsValid(IPlayerController)) continue;
 
 		IPlayerController->ClientRecieveAnnouncement(CharacterDataSaving);
-
-		// Save Players Info
-		SaveAll(IPlayerController, ESavePriority::Medium);
 	}
+
+	// Save Players Info, taking over any queued save for the same character so it is only written once
+	SaveAllPlayers();
+
+	// Whatever is left belongs to characters no controller is possessing anymore
+	FlushSaveQueue();
 	
 	if (DatabaseEngine)
 	{
@@ -5358,6 +5944,12 @@ void AIGameMode::SaveDataForShutdown()
 		DatabaseEngine->Flush(bServerShutdown);
 	}
 
+	// Restart webhooks were fired just before this, send them before the process exits
+	if (UWebhookDispatcher* WebhookDispatcher = UWebhookDispatcher::Get())
+	{
+		WebhookDispatcher->Flush();
+	}
+
 	// Flush Database HTTPs Requests so they get sent out!
 	// Infinite wait, should only be used in non-game scenarios where longer waits are acceptable
 	FHttpManager& HttpManager = FHttpModule::Get().GetHttpManager();
@@ -1,6 +1,7 @@
 // Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
 
 #include "Online/IGameSession.h"
+#include "Online/WebhookDispatcher.h"
 #include "Online/IPlayerState.h"
 #include "GameMode/IGameMode.h"
 #include "IGameEngine.h"
@@ -74,7 +75,7 @@ void AIGameSession::CheckForHotReload()
 			FDateTime LastEditTime = IFileManager::Get().GetTimeStamp(*FileLocation);
 			if (LastEditTime != FailedAccess && LastEditTime > LastBansEditTime)
 			{
-				LoadBans();
+				HotReloadBans();
 				UE_LOG(TitansNetwork, Warning, TEXT("IGameSession::CheckForHotReload: Reloading %s due to modified time being newer. %s > %s"), *FileName, *LastEditTime.ToString(), *LastBansEditTime.ToString())
 			} else {
 				//UE_LOG(TitansNetwork, Log, TEXT("IGameSession::CheckForHotReload: Skipping Reload of %s LastEditTime: %s LastBansEditTime:  %s"), *FileName, *LastEditTime.ToString(), *LastBansEditTime.ToString())
@@ -91,7 +92,7 @@ void AIGameSession::CheckForHotReload()
 			FDateTime LastEditTime = IFileManager::Get().GetTimeStamp(*FileLocation);
 			if (LastEditTime != FailedAccess && LastEditTime > LastMutesEditTime)
 			{
-				LoadMutes();
+				HotReloadMutes();
 				UE_LOG(TitansNetwork, Warning, TEXT("IGameSession::CheckForHotReload: Reloading %s due to modified time being newer. %s > %s"), *FileName, *LastEditTime.ToString(), *LastMutesEditTime.ToString())
 			} else {
 				//UE_LOG(TitansNetwork, Log, TEXT("IGameSession::CheckForHotReload: Skipping Reload of %s LastEditTime: %s LastMutesEditTime:  %s"), *FileName, *LastEditTime.ToString(), *LastMutesEditTime.ToString())
@@ -108,13 +109,169 @@ void AIGameSession::CheckForHotReload()
 			FDateTime LastEditTime = IFileManager::Get().GetTimeStamp(*FileLocation);
 			if (LastEditTime != FailedAccess && LastEditTime > LastWhitelistEditTime)
 			{
-				LoadWhitelist();
+				HotReloadWhitelist();
 				UE_LOG(TitansNetwork, Warning, TEXT("IGameSession::CheckForHotReload: Reloading %s due to modified time being newer. %s > %s"), *FileName, *LastEditTime.ToString(), *LastWhitelistEditTime.ToString())
 			} else {
 				//UE_LOG(TitansNetwork, Log, TEXT("IGameSession::CheckForHotReload: Skipping Reload of %s LastEditTime: %s LastWhitelistEditTime:  %s"), *FileName, *LastEditTime.ToString(), *LastWhitelistEditTime.ToString())
 			}
 		}
 	}
+
+	CompactModerationJournals();
+}
+
+void AIGameSession::HotReloadBans()
+{
+	TArray<FString> Records;
+	switch (BansJournal.ReadDelta(Records))
+	{
+	case FModerationJournal::EReadResult::Full:
+		LoadBanRecords(Records);
+		break;
+	case FModerationJournal::EReadResult::Delta:
+		UE_LOG(TitansNetwork, Log, TEXT("IGameSession::HotReloadBans: Applied %i of %i new records"), ApplyBanRecords(Records), Records.Num())
+		KickBannedPlayers();
+		break;
+	default:
+		break;
+	}
+
+	LastBansEditTime = FDateTime::UtcNow();
+}
+
+void AIGameSession::HotReloadMutes()
+{
+	TArray<FString> Records;
+	switch (MutesJournal.ReadDelta(Records))
+	{
+	case FModerationJournal::EReadResult::Full:
+		LoadMuteRecords(Records);
+		break;
+	case FModerationJournal::EReadResult::Delta:
+		UE_LOG(TitansNetwork, Log, TEXT("IGameSession::HotReloadMutes: Applied %i of %i new records"), ApplyMuteRecords(Records), Records.Num())
+		RefreshServerMutedPlayers();
+		break;
+	default:
+		break;
+	}
+
+	LastMutesEditTime = FDateTime::UtcNow();
+}
+
+void AIGameSession::HotReloadWhitelist()
+{
+	TArray<FString> Records;
+	switch (WhitelistJournal.ReadDelta(Records))
+	{
+	case FModerationJournal::EReadResult::Full:
+		ServerWhitelist.Reset();
+		ApplyWhitelistRecords(Records, false);
+		break;
+	case FModerationJournal::EReadResult::Delta:
+		UE_LOG(TitansNetwork, Log, TEXT("IGameSession::HotReloadWhitelist: Applied %i of %i new records"), ApplyWhitelistRecords(Records, true), Records.Num())
+		break;
+	default:
+		break;
+	}
+
+	LastWhitelistEditTime = FDateTime::UtcNow();
+}
+
+void AIGameSession::CompactModerationJournals()
+{
+	if (BansJournal.ShouldCompact(Bans.Num(), ModerationJournalCompactRecords))
+	{
+		UE_LOG(TitansNetwork, Log, TEXT("IGameSession::CompactModerationJournals: Compacting bans.txt, %i records for %i bans"), BansJournal.GetNumRecords(), Bans.Num())
+		SaveBans();
+	}
+
+	if (MutesJournal.ShouldCompact(ServerMutes.Num(), ModerationJournalCompactRecords))
+	{
+		UE_LOG(TitansNetwork, Log, TEXT("IGameSession::CompactModerationJournals: Compacting mutes.txt, %i records for %i mutes"), MutesJournal.GetNumRecords(), ServerMutes.Num())
+		SaveMutes();
+	}
+
+	if (WhitelistJournal.ShouldCompact(ServerWhitelist.Num(), ModerationJournalCompactRecords))
+	{
+		UE_LOG(TitansNetwork, Log, TEXT("IGameSession::CompactModerationJournals: Compacting whitelist.txt, %i records for %i entries"), WhitelistJournal.GetNumRecords(), ServerWhitelist.Num())
+		SaveWhitelist();
+	}
+}
+
+FString AIGameSession::BenchmarkModerationJournal(int32 NumEntries)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameSession::BenchmarkModerationJournal"))
+
+	NumEntries = FMath::Max(NumEntries, 1);
+	const int32 NumDeltaEntries = FMath::Max(NumEntries / 100, 1);
+	const uint64 Now = static_cast<uint64>(FDateTime::UtcNow().ToUnixTimestamp());
+
+	auto MakeBenchmarkId = [](int32 Index)
+	{
+		return FString::Printf(TEXT("%03d-%03d-%03d"), (Index / 1000000) % 1000, (Index / 1000) % 1000, Index % 1000);
+	};
+
+	auto MakeBenchmarkBan = [&MakeBenchmarkId, Now](int32 Index)
+	{
+		FPlayerBan Ban;
+		Ban.PlayerId = FAlderonPlayerID(MakeBenchmarkId(Index));
+		Ban.BanExpiration = (Index % 4 == 0) ? Now + 3600 : 0;
+		Ban.AdminReason = TEXT("Benchmark");
+		return Ban.ToString();
+	};
+
+	TArray<FString> Lines;
+	Lines.Reserve(NumEntries);
+	for (int32 Index = 0; Index < NumEntries; Index++)
+	{
+		Lines.Add(MakeBenchmarkBan(Index));
+	}
+
+	FModerationJournal Journal(TEXT("bans_benchmark.txt"));
+	Journal.Rewrite(Lines);
+
+	// Swap the live bans out so the real parsing and indexing code can be timed without touching them
+	TArray<FPlayerBan> LiveBans = MoveTemp(Bans);
+	Bans.Reset();
+	RebuildBanIndex();
+
+	TArray<FString> Records;
+
+	const double FullStart = FPlatformTime::Seconds();
+	Journal.ReadAll(Records);
+	ApplyBanRecords(Records);
+	const double FullSeconds = FPlatformTime::Seconds() - FullStart;
+	const int32 NumLoaded = Bans.Num();
+
+	// A second journal stands in for an external tool appending to the file
+	TArray<FString> DeltaRecords;
+	DeltaRecords.Reserve(NumDeltaEntries * 2);
+	for (int32 Index = 0; Index < NumDeltaEntries; Index++)
+	{
+		DeltaRecords.Add(MakeBenchmarkBan(NumEntries + Index));
+		DeltaRecords.Add(FModerationJournal::MakeRemovalRecord(MakeBenchmarkBan(Index)));
+	}
+
+	FModerationJournal ExternalWriter(TEXT("bans_benchmark.txt"));
+	ExternalWriter.Append(DeltaRecords);
+
+	const double DeltaStart = FPlatformTime::Seconds();
+	const FModerationJournal::EReadResult DeltaResult = Journal.ReadDelta(Records);
+	const int32 NumApplied = ApplyBanRecords(Records);
+	const double DeltaSeconds = FPlatformTime::Seconds() - DeltaStart;
+
+	Bans = MoveTemp(LiveBans);
+	RebuildBanIndex();
+
+	IFileManager::Get().Delete(*Journal.GetFilePath());
+
+	const FString Summary = FString::Printf(TEXT("ModerationJournal: %d entries. Full load: %.3fms (%d bans) Delta: %d records in %.3fms (%d applied, %s)"),
+		NumEntries, FullSeconds * 1000.0, NumLoaded, Records.Num(), DeltaSeconds * 1000.0, NumApplied,
+		DeltaResult == FModerationJournal::EReadResult::Delta ? TEXT("delta") : TEXT("full reload"));
+
+	UE_LOG(TitansNetwork, Log, TEXT("AIGameSession::BenchmarkModerationJournal: %s"), *Summary);
+
+	return Summary;
 }
 
 void AIGameSession::SetupHotReloadTimer()
@@ -361,6 +518,18 @@ void FPlayerMute::FromString(FString Line)
 	}
 }
 
+static void RemoveFromModerationIndex(TMap<FString, FModerationIndexList>& Index, const FString& Key, int32 EntryIndex)
+{
+	if (FModerationIndexList* Entries = Index.Find(Key))
+	{
+		Entries->RemoveSingle(EntryIndex);
+		if (Entries->Num() == 0)
+		{
+			Index.Remove(Key);
+		}
+	}
+}
+
 void AIGameSession::ConvertOldBans()
 {
 	if (BannedUsers.Num() > 0)
@@ -370,7 +539,7 @@ void AIGameSession::ConvertOldBans()
 			FPlayerBan Ban;
 			Ban.PlayerId = BanInfo.UniqueID;
 			Ban.BanExpiration = 0;
-			Bans.Add(Ban);
+			AddBanToIndex(Bans.Add(Ban));
 		}
 
 		SaveBans();
@@ -382,47 +551,157 @@ void AIGameSession::ConvertOldBans()
 
 void AIGameSession::LoadBans()
 {
-	FString BansLocation = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("bans.txt"));
-	if (!FPaths::FileExists(BansLocation))
+	if (!BansJournal.Exists())
 	{
 		if (IsRunningDedicatedServer())
 		{
-			UE_LOG(TitansNetwork, Error, TEXT("IGameSession::LoadBans: File doesn't exist: %s"), *BansLocation)
+			UE_LOG(TitansNetwork, Error, TEXT("IGameSession::LoadBans: File doesn't exist: %s"), *BansJournal.GetFilePath())
 			SaveBans();
 		}
 		return;
 	}
 
-	TArray<FString> Lines;
-
-	FFileHelper::LoadFileToStringArray(Lines, *BansLocation);
+	TArray<FString> Records;
+	BansJournal.ReadAll(Records);
 	LastBansEditTime = FDateTime::UtcNow();
 
-	int LineNumber = 0;
+	LoadBanRecords(Records);
+}
 
-	TArray<FString> BanLineArray;
-	BanLineArray.Reserve(4);
+void AIGameSession::LoadBanRecords(const TArray<FString>& Records)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameSession::LoadBanRecords"))
 
-	Bans.Empty(Lines.Num());
+	Bans.Empty(Records.Num());
+	RebuildBanIndex();
 
-	for (const FString& Line : Lines)
+	ApplyBanRecords(Records);
+	Bans.Shrink();
+
+	UE_LOG(TitansNetwork, Log, TEXT("IGameSession::LoadBans: Loaded %i bans from %i records"), Bans.Num(), BansJournal.GetNumRecords())
+
+	KickBannedPlayers();
+}
+
+int32 AIGameSession::ApplyBanRecords(const TArray<FString>& Records)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameSession::ApplyBanRecords"))
+
+	TSet<int32> RemovedBans;
+	int32 NumApplied = 0;
+
+	for (const FString& Record : Records)
 	{
-		LineNumber++;
+		if (FModerationJournal::IsComment(Record))
+		{
+			continue;
+		}
 
-		if (Line.StartsWith(TEXT("//")) || Line.StartsWith(TEXT(";")))
+		FString RemovedEntry;
+		if (FModerationJournal::ParseRemovalRecord(Record, RemovedEntry))
 		{
+			const int32 BanIndex = FindBanToRemove(RemovedEntry, RemovedBans);
+			if (BanIndex != INDEX_NONE)
+			{
+				const FPlayerBan& Ban = Bans[BanIndex];
+				if (Ban.PlayerId.IsValid())
+				{
+					RemoveFromModerationIndex(BanIdIndex, Ban.PlayerId.ToDisplayString(), BanIndex);
+				}
+				if (!Ban.IPAddress.IsEmpty())
+				{
+					RemoveFromModerationIndex(BanIPIndex, Ban.IPAddress, BanIndex);
+				}
+
+				RemovedBans.Add(BanIndex);
+				NumApplied++;
+			}
 			continue;
 		}
 
 		FPlayerBan Ban;
-		Ban.FromString(Line);
+		Ban.FromString(Record);
 
-		UE_LOG(TitansNetwork, Log, TEXT("IGameSession::LoadBans: Ban Id: %s IP: %s"), *Ban.PlayerId.ToDisplayString(), *Ban.IPAddress)
-		Bans.Add(Ban);
+		if (!Ban.PlayerId.IsValid() && Ban.IPAddress.IsEmpty())
+		{
+			continue;
+		}
+
+		// Our own appends can be read back when another writer appended at the same time
+		const FPlayerBan* const ExistingBan = Ban.PlayerId.IsValid() ? FindActiveBan(Ban.PlayerId.ToDisplayString()) : nullptr;
+		if (ExistingBan && ExistingBan->ToString() == Ban.ToString())
+		{
+			continue;
+		}
+
+		UE_LOG(TitansNetwork, Verbose, TEXT("IGameSession::ApplyBanRecords: Ban Id: %s IP: %s"), *Ban.PlayerId.ToDisplayString(), *Ban.IPAddress)
+		AddBanToIndex(Bans.Add(Ban));
+		NumApplied++;
 	}
 
-	Bans.Shrink();
+	if (RemovedBans.Num() > 0)
+	{
+		int32 WriteIndex = 0;
+		for (int32 ReadIndex = 0; ReadIndex < Bans.Num(); ReadIndex++)
+		{
+			if (!RemovedBans.Contains(ReadIndex))
+			{
+				if (WriteIndex != ReadIndex)
+				{
+					Bans[WriteIndex] = MoveTemp(Bans[ReadIndex]);
+				}
+				WriteIndex++;
+			}
+		}
+
+		Bans.SetNum(WriteIndex, false);
+		RebuildBanIndex();
+	}
+
+	return NumApplied;
+}
+
+int32 AIGameSession::FindBanToRemove(const FString& RemovedEntry, const TSet<int32>& RemovedBans) const
+{
+	// A bare key (older journals, or a lookup by id / IP) matches the latest ban with that key, a full line only that entry
+	const FString Key = FModerationJournal::GetEntryKey(RemovedEntry);
+	const bool bExactEntry = Key != RemovedEntry;
+
+	auto IsMatch = [this, &RemovedBans, &RemovedEntry, bExactEntry](int32 BanIndex)
+	{
+		return !RemovedBans.Contains(BanIndex) && (!bExactEntry || Bans[BanIndex].ToString().TrimStartAndEnd() == RemovedEntry);
+	};
+
+	// Latest active ban first, IP before Alderon Id like the old removal scan
+	for (const TMap<FString, FModerationIndexList>* Index : { &BanIPIndex, &BanIdIndex })
+	{
+		if (const FModerationIndexList* Entries = Index->Find(Key))
+		{
+			for (int32 EntryIndex = Entries->Num(); EntryIndex-- > 0;)
+			{
+				if (IsMatch((*Entries)[EntryIndex]))
+				{
+					return (*Entries)[EntryIndex];
+				}
+			}
+		}
+	}
 
+	// Expired bans aren't indexed but can still be removed from the file
+	for (int32 BanIndex = Bans.Num(); BanIndex-- > 0;)
+	{
+		const FPlayerBan& Ban = Bans[BanIndex];
+		if (IsMatch(BanIndex) && (Ban.IPAddress == Key || (Ban.PlayerId.IsValid() && Ban.PlayerId.ToDisplayString() == Key)))
+		{
+			return BanIndex;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+void AIGameSession::KickBannedPlayers()
+{
 	AGameStateBase* GameState = GetWorld()->GetGameState();
 	if (GameState)
 	{
@@ -440,13 +719,10 @@ void AIGameSession::LoadBans()
 			}
 		}
 	}
-	
 }
 
 void AIGameSession::SaveBans()
 {
-	FString BansLocation = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("bans.txt"));
-
 	TArray<FString> Lines;
 	Lines.Add(TEXT("// Ban List for Path of Titans"));
 	Lines.Add(TEXT("// Format Information"));
@@ -457,7 +733,7 @@ void AIGameSession::SaveBans()
 	Lines.Add(TEXT("//(EXAMPLE) 525-053-709:0:Reason for admins here:Stay out of my server"));
 	Lines.Add(TEXT("//(EXAMPLE) 127.0.0.1:0:KOSER:Killing people on sight"));
 
-	Lines.Reserve(Bans.Num());
+	Lines.Reserve(Lines.Num() + Bans.Num());
 
 	for (const FPlayerBan& Ban : Bans)
 	{
@@ -465,7 +741,7 @@ void AIGameSession::SaveBans()
 		Lines.Add(Line);
 	}
 
-	FFileHelper::SaveStringArrayToFile(Lines, *BansLocation);
+	BansJournal.Rewrite(Lines);
 	LastBansEditTime = FDateTime::UtcNow();
 }
 
@@ -487,8 +763,13 @@ void AIGameSession::AppendBan(FPlayerBan Ban)
 		AIGameSession::TriggerWebHookFromContext(this, WEBHOOK_ServerModerate, WebHookProperties);
 	}
 
-	Bans.Add(Ban);
-	SaveBans();
+	AddBanToIndex(Bans.Add(Ban));
+
+	if (!BansJournal.Append(Ban.ToString()))
+	{
+		SaveBans();
+	}
+	LastBansEditTime = FDateTime::UtcNow();
 
 	AGameStateBase* GameState = GetWorld()->GetGameState();
 	check(GameState);
@@ -512,7 +793,7 @@ void AIGameSession::AppendBan(FPlayerBan Ban)
 	}
 }
 
-// Remove a ban and re-write the whole file
+// Remove a ban by appending a removal record
 void AIGameSession::RemoveBan(FPlayerBan Ban)
 {
 	if (AIGameSession::UseWebHooks(WEBHOOK_ServerModerate))
@@ -530,80 +811,171 @@ void AIGameSession::RemoveBan(FPlayerBan Ban)
 		AIGameSession::TriggerWebHookFromContext(this, WEBHOOK_ServerModerate, WebHookProperties);
 	}
 
-	for (int i = Bans.Num(); i-- > 0;)
+	// The removal record names the exact ban lifted now and is replayed on load, so it goes through the same path
+	for (const FString& Key : { Ban.IPAddress, Ban.PlayerId.IsValid() ? Ban.PlayerId.ToDisplayString() : FString() })
 	{
-		bool bRemove = false;
-		const FPlayerBan& PlayerBan = Bans[i];
-
-		if (!PlayerBan.IPAddress.IsEmpty() && !Ban.IPAddress.IsEmpty() && PlayerBan.IPAddress == Ban.IPAddress)
+		if (Key.IsEmpty())
 		{
-			bRemove = true;
+			continue;
 		}
-		else if (PlayerBan.PlayerId == Ban.PlayerId)
+
+		const int32 BanIndex = FindBanToRemove(Key, TSet<int32>());
+		if (BanIndex == INDEX_NONE)
 		{
-			bRemove = true;
+			continue;
 		}
 
-		if (bRemove)
+		const FString RemovalRecord = FModerationJournal::MakeRemovalRecord(Bans[BanIndex].ToString());
+		if (ApplyBanRecords({ RemovalRecord }) > 0)
 		{
-			Bans.RemoveAt(i);
+			if (!BansJournal.Append(RemovalRecord))
+			{
+				SaveBans();
+			}
+			LastBansEditTime = FDateTime::UtcNow();
 			break;
 		}
 	}
-	
-	SaveBans();
 }
 
 void AIGameSession::LoadMutes()
 {
-	FString MutesLocation = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("mutes.txt"));
-	if (!FPaths::FileExists(MutesLocation))
+	if (!MutesJournal.Exists())
 	{
 		if (IsRunningDedicatedServer())
 		{
-			UE_LOG(TitansNetwork, Error, TEXT("IGameSession::LoadMutes: File doesn't exist: %s"), *MutesLocation)
+			UE_LOG(TitansNetwork, Error, TEXT("IGameSession::LoadMutes: File doesn't exist: %s"), *MutesJournal.GetFilePath())
 			SaveMutes();
 		}
 		return;
 	}
 
-	TArray<FString> Lines;
-
-	FFileHelper::LoadFileToStringArray(Lines, *MutesLocation);
+	TArray<FString> Records;
+	MutesJournal.ReadAll(Records);
 	LastMutesEditTime = FDateTime::UtcNow();
 
-	int LineNumber = 0;
+	LoadMuteRecords(Records);
+}
 
-	TArray<FString> BanLineArray;
-	BanLineArray.Reserve(4);
+void AIGameSession::LoadMuteRecords(const TArray<FString>& Records)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameSession::LoadMuteRecords"))
+
+	ServerMutes.Empty(Records.Num());
+	RebuildMuteIndex();
+
+	ApplyMuteRecords(Records);
+	ServerMutes.Shrink();
 
-	ServerMutes.Empty(Lines.Num());
+	UE_LOG(TitansNetwork, Log, TEXT("IGameSession::LoadMutes: Loaded %i mutes from %i records"), ServerMutes.Num(), MutesJournal.GetNumRecords())
 
-	for (const FString& Line : Lines)
+	RefreshServerMutedPlayers();
+}
+
+int32 AIGameSession::ApplyMuteRecords(const TArray<FString>& Records)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameSession::ApplyMuteRecords"))
+
+	TSet<int32> RemovedMutes;
+	int32 NumApplied = 0;
+
+	for (const FString& Record : Records)
 	{
-		LineNumber++;
+		if (FModerationJournal::IsComment(Record))
+		{
+			continue;
+		}
 
-		if (Line.StartsWith(TEXT("//")) || Line.StartsWith(TEXT(";")))
+		FString RemovedEntry;
+		if (FModerationJournal::ParseRemovalRecord(Record, RemovedEntry))
 		{
+			const int32 MuteIndex = FindMuteToRemove(RemovedEntry, RemovedMutes);
+			if (MuteIndex != INDEX_NONE)
+			{
+				RemoveFromModerationIndex(MuteIdIndex, ServerMutes[MuteIndex].PlayerId.ToDisplayString(), MuteIndex);
+				RemovedMutes.Add(MuteIndex);
+				NumApplied++;
+			}
 			continue;
 		}
 
 		FPlayerMute Mute;
-		Mute.FromString(Line);
+		Mute.FromString(Record);
 
-		if (Mute.IsValid())
+		if (!Mute.IsValid())
 		{
-			UE_LOG(TitansNetwork, Log, TEXT("IGameSession::LoadMutes: Mute Id: %s Line: %i"), *Mute.PlayerId.ToDisplayString(), LineNumber)
-			ServerMutes.Add(Mute);
+			UE_LOG(TitansNetwork, Verbose, TEXT("IGameSession::ApplyMuteRecords: Skipping invalid / expired mute %s"), *Record)
+			continue;
 		}
-		else
+
+		const FPlayerMute* const ExistingMute = FindActiveMute(Mute.PlayerId.ToDisplayString());
+		if (ExistingMute && ExistingMute->ToString() == Mute.ToString())
+		{
+			continue;
+		}
+
+		UE_LOG(TitansNetwork, Verbose, TEXT("IGameSession::ApplyMuteRecords: Mute Id: %s"), *Mute.PlayerId.ToDisplayString())
+		AddMuteToIndex(ServerMutes.Add(Mute));
+		NumApplied++;
+	}
+
+	if (RemovedMutes.Num() > 0)
+	{
+		int32 WriteIndex = 0;
+		for (int32 ReadIndex = 0; ReadIndex < ServerMutes.Num(); ReadIndex++)
 		{
-			UE_LOG(TitansNetwork, Log, TEXT("IGameSession::LoadMutes: Skipping Mute on line %i due to it being invalid / expired."), LineNumber)
+			if (!RemovedMutes.Contains(ReadIndex))
+			{
+				if (WriteIndex != ReadIndex)
+				{
+					ServerMutes[WriteIndex] = MoveTemp(ServerMutes[ReadIndex]);
+				}
+				WriteIndex++;
+			}
 		}
+
+		ServerMutes.SetNum(WriteIndex, false);
+		RebuildMuteIndex();
 	}
 
-	ServerMutes.Shrink();
+	return NumApplied;
+}
 
+int32 AIGameSession::FindMuteToRemove(const FString& RemovedEntry, const TSet<int32>& RemovedMutes) const
+{
+	// Same matching as FindBanToRemove
+	const FString Key = FModerationJournal::GetEntryKey(RemovedEntry);
+	const bool bExactEntry = Key != RemovedEntry;
+
+	auto IsMatch = [this, &RemovedMutes, &RemovedEntry, bExactEntry](int32 MuteIndex)
+	{
+		return !RemovedMutes.Contains(MuteIndex) && (!bExactEntry || ServerMutes[MuteIndex].ToString().TrimStartAndEnd() == RemovedEntry);
+	};
+
+	if (const FModerationIndexList* Entries = MuteIdIndex.Find(Key))
+	{
+		for (int32 EntryIndex = Entries->Num(); EntryIndex-- > 0;)
+		{
+			if (IsMatch((*Entries)[EntryIndex]))
+			{
+				return (*Entries)[EntryIndex];
+			}
+		}
+	}
+
+	for (int32 MuteIndex = ServerMutes.Num(); MuteIndex-- > 0;)
+	{
+		if (IsMatch(MuteIndex) && ServerMutes[MuteIndex].PlayerId.ToDisplayString() == Key)
+		{
+			return MuteIndex;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+void AIGameSession::RefreshServerMutedPlayers()
+{
 	AGameStateBase* GameState = GetWorld()->GetGameState();
 	if (GameState)
 	{
@@ -621,8 +993,6 @@ void AIGameSession::LoadMutes()
 
 void AIGameSession::SaveMutes()
 {
-	FString MutesLocation = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("mutes.txt"));
-
 	TArray<FString> Lines;
 	Lines.Add(TEXT("// Mute List for Path of Titans"));
 	Lines.Add(TEXT("// Format Information"));
@@ -632,7 +1002,7 @@ void AIGameSession::SaveMutes()
 	Lines.Add(TEXT("// UserReason - Reason the user was muted (displayed to the user) (Optional)"));
 	Lines.Add(TEXT("//(EXAMPLE) 525-053-709:0:Reason for admins here:Stay out of my server"));
 
-	Lines.Reserve(ServerMutes.Num());
+	Lines.Reserve(Lines.Num() + ServerMutes.Num());
 
 	for (const FPlayerMute& Mute : ServerMutes)
 	{
@@ -640,7 +1010,7 @@ void AIGameSession::SaveMutes()
 		Lines.Add(Line);
 	}
 
-	FFileHelper::SaveStringArrayToFile(Lines, *MutesLocation);
+	MutesJournal.Rewrite(Lines);
 	LastMutesEditTime = FDateTime::UtcNow();
 }
 
@@ -661,8 +1031,13 @@ void AIGameSession::AppendMute(FPlayerMute Mute)
 		AIGameSession::TriggerWebHookFromContext(this, WEBHOOK_ServerModerate, WebHookProperties);
 	}
 
-	ServerMutes.Add(Mute);
-	SaveMutes();
+	AddMuteToIndex(ServerMutes.Add(Mute));
+
+	if (!MutesJournal.Append(Mute.ToString()))
+	{
+		SaveMutes();
+	}
+	LastMutesEditTime = FDateTime::UtcNow();
 
 	AGameStateBase* GameState = GetWorld()->GetGameState();
 	check(GameState);
@@ -684,7 +1059,7 @@ void AIGameSession::AppendMute(FPlayerMute Mute)
 	}
 }
 
-// Remove a ban and re-write the whole file
+// Remove a mute by appending a removal record
 bool AIGameSession::RemoveMute(FPlayerMute Mute)
 {
 	if (AIGameSession::UseWebHooks(WEBHOOK_ServerModerate))
@@ -701,26 +1076,20 @@ bool AIGameSession::RemoveMute(FPlayerMute Mute)
 		AIGameSession::TriggerWebHookFromContext(this, WEBHOOK_ServerModerate, WebHookProperties);
 	}
 
-	bool bRemove = false;
+	// Record the exact mute lifted now, so replaying it can't lift a newer mute for the same player
+	const int32 MuteIndex = Mute.PlayerId.IsValid() ? FindMuteToRemove(Mute.PlayerId.ToDisplayString(), TSet<int32>()) : INDEX_NONE;
+	const FString RemovalRecord = MuteIndex != INDEX_NONE ? FModerationJournal::MakeRemovalRecord(ServerMutes[MuteIndex].ToString()) : FString();
+	const bool bRemove = MuteIndex != INDEX_NONE && ApplyMuteRecords({ RemovalRecord }) > 0;
 
-	for (int i = ServerMutes.Num(); i-- > 0;)
+	if (bRemove)
 	{
-		const FPlayerMute& PlayerMute = ServerMutes[i];
-
-		if (PlayerMute.PlayerId == Mute.PlayerId)
-		{
-			bRemove = true;
-		}
-
-		if (bRemove)
+		if (!MutesJournal.Append(RemovalRecord))
 		{
-			ServerMutes.RemoveAt(i);
-			break;
+			SaveMutes();
 		}
+		LastMutesEditTime = FDateTime::UtcNow();
 	}
 
-	SaveMutes();
-
 	AGameStateBase* GameState = GetWorld()->GetGameState();
 	check(GameState);
 	if (!GameState)
@@ -745,47 +1114,63 @@ bool AIGameSession::RemoveMute(FPlayerMute Mute)
 
 void AIGameSession::LoadWhitelist()
 {
-	FString WhitelistLocation = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("whitelist.txt"));
-	if (!FPaths::FileExists(WhitelistLocation))
+	if (!WhitelistJournal.Exists())
 	{
 		if (IsRunningDedicatedServer())
 		{
-			UE_LOG(TitansNetwork, Warning, TEXT("IGameSession::LoadWhitelist: File doesn't exist: %s"), *WhitelistLocation)
+			UE_LOG(TitansNetwork, Warning, TEXT("IGameSession::LoadWhitelist: File doesn't exist: %s"), *WhitelistJournal.GetFilePath())
 			SaveWhitelist();
 		}
 		return;
 	}
 
-	TArray<FString> Lines;
-
-	FFileHelper::LoadFileToStringArray(Lines, *WhitelistLocation);
+	TArray<FString> Records;
+	WhitelistJournal.ReadAll(Records);
 	LastWhitelistEditTime = FDateTime::UtcNow();
 
-	ServerWhitelist.Empty(Lines.Num());
+	ServerWhitelist.Empty(Records.Num());
+	ApplyWhitelistRecords(Records, false);
+	ServerWhitelist.Shrink();
+}
+
+int32 AIGameSession::ApplyWhitelistRecords(const TArray<FString>& Records, bool bUnique)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameSession::ApplyWhitelistRecords"))
 
-	int LineNumber = 0;
+	int32 NumApplied = 0;
 
-	for (const FString& Line : Lines)
+	for (const FString& Record : Records)
 	{
-		LineNumber++;
+		if (FModerationJournal::IsComment(Record))
+		{
+			continue;
+		}
 
-		if (Line.StartsWith(TEXT("//")) || Line.StartsWith(TEXT(";")))
+		// Whitelist entries are just the Alderon Id, so the removed entry is its own key
+		FString RemovedEntry;
+		if (FModerationJournal::ParseRemovalRecord(Record, RemovedEntry))
 		{
+			NumApplied += ServerWhitelist.Remove(FAlderonPlayerID(RemovedEntry)) > 0 ? 1 : 0;
 			continue;
 		}
 
-		FAlderonPlayerID WhitelistPlayerId = FAlderonPlayerID(Line);
-		if (WhitelistPlayerId.IsValid())
+		FAlderonPlayerID WhitelistPlayerId = FAlderonPlayerID(Record);
+		if (!WhitelistPlayerId.IsValid())
 		{
-			ServerWhitelist.Add(WhitelistPlayerId);
+			UE_LOG(TitansNetwork, Error, TEXT("IGameSession::LoadWhitelist: Skipping %s due to invalid Alderon Id."), *Record)
+			continue;
 		}
-		else
+
+		if (bUnique && ServerWhitelist.Contains(WhitelistPlayerId))
 		{
-			UE_LOG(TitansNetwork, Error, TEXT("IGameSession::LoadWhitelist: Skipping Line %i due to invalid Alderon Id."), LineNumber)
+			continue;
 		}
+
+		ServerWhitelist.Add(WhitelistPlayerId);
+		NumApplied++;
 	}
 
-	ServerWhitelist.Shrink();
+	return NumApplied;
 }
 
 bool AIGameSession::IsWhitelistActive()
@@ -795,15 +1180,13 @@ bool AIGameSession::IsWhitelistActive()
 
 void AIGameSession::SaveWhitelist()
 {
-	FString WhitelistLocation = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("whitelist.txt"));
-
 	TArray<FString> Lines;
 	Lines.Add(TEXT("// Alderon Id Whitelist for Path of Titans"));
 	Lines.Add(TEXT("// Format Information"));
 	Lines.Add(TEXT("// Alderon Id (required)"));
 	Lines.Add(TEXT("//(EXAMPLE) 525-053-709"));
 
-	Lines.Reserve(ServerWhitelist.Num());
+	Lines.Reserve(Lines.Num() + ServerWhitelist.Num());
 
 	for (const FAlderonPlayerID& AlderonId : ServerWhitelist)
 	{
@@ -813,7 +1196,7 @@ void AIGameSession::SaveWhitelist()
 		}
 	}
 
-	FFileHelper::SaveStringArrayToFile(Lines, *WhitelistLocation);
+	WhitelistJournal.Rewrite(Lines);
 	LastWhitelistEditTime = FDateTime::UtcNow();
 }
 
@@ -830,8 +1213,18 @@ void AIGameSession::AppendWhitelist(const FAlderonPlayerID& AlderonId)
 		AIGameSession::TriggerWebHookFromContext(this, WEBHOOK_ServerModerate, WebHookProperties);
 	}
 
-	ServerWhitelist.AddUnique(AlderonId);
-	SaveWhitelist();
+	if (ServerWhitelist.Contains(AlderonId))
+	{
+		return;
+	}
+
+	ServerWhitelist.Add(AlderonId);
+
+	if (!WhitelistJournal.Append(AlderonId.ToDisplayString()))
+	{
+		SaveWhitelist();
+	}
+	LastWhitelistEditTime = FDateTime::UtcNow();
 }
 
 bool AIGameSession::RemoveWhitelist(const FAlderonPlayerID& AlderonId)
@@ -848,12 +1241,25 @@ bool AIGameSession::RemoveWhitelist(const FAlderonPlayerID& AlderonId)
 	}
 
 	int Count = ServerWhitelist.Remove(AlderonId);
-	SaveWhitelist();
+	if (Count != 0)
+	{
+		if (!WhitelistJournal.Append(FModerationJournal::MakeRemovalRecord(AlderonId.ToDisplayString())))
+		{
+			SaveWhitelist();
+		}
+		LastWhitelistEditTime = FDateTime::UtcNow();
+	}
 	return Count != 0;
 }
 
 bool AIGameSession::UseWebHooks(const FString& WebhookKey)
 {
+	// Cached config, this is checked before building every webhook
+	if (const UWebhookDispatcher* Dispatcher = UWebhookDispatcher::Get())
+	{
+		return Dispatcher->AreWebhooksEnabled();
+	}
+
 	bool bEnabled = false;
 	GConfig->GetBool(TEXT("ServerWebhooks"), TEXT("bEnabled"), bEnabled, GGameIni);
 	if (!bEnabled) return false;
@@ -891,174 +1297,18 @@ void AIGameSession::TriggerWebHook(const UWebhook* Webhook)
 
 void AIGameSession::TriggerWebHook(const FString& WebhookKey, const TMap<FString, TSharedPtr<FJsonValue>>& Properties)
 {
-	FHttpRequestPtr HttpRequest = IAlderonCommon::CreateRequest(EAlderonWebRequestVerb::POST);
-
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &AIGameSession::TriggerWebHook_Callback, WebhookKey);
-
-	FString WebHookUrl, WebhookFormat;
-	GConfig->GetString(TEXT("ServerWebhooks"), *WebhookKey, WebHookUrl, GGameIni);
-	GConfig->GetString(TEXT("ServerWebhooks"),TEXT("Format"), WebhookFormat, GGameIni);
-
-	UE_LOG(TitansNetwork, Log, TEXT("TriggerWebhook: Key: %s Url %s"), *WebhookKey, *WebHookUrl)
-
-	TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
-
-	if (!WebHookUrl.IsEmpty())
-	{
-		if (WebhookFormat.ToLower() == TEXT("discord"))
-		{
-			FString DiscordMessage = "";
-
-			for (auto& Elem : Properties)
-			{
-				// **PropertyName:** 
-				DiscordMessage += TEXT("**") + Elem.Key + TEXT(":** ");
-				
-				// String
-				FJsonValue* ValuePtr = Elem.Value.Get();
-				if (FJsonValueString* StringValue = (FJsonValueString*)(ValuePtr))
-				{
-					FString String = StringValue->AsString();
-					// add backslash discord format characters to prevent unintentional formatting
-					String = String.Replace(TEXT("*"), TEXT("\\*"));
-					String = String.Replace(TEXT("~"), TEXT("\\~"));
-					String = String.Replace(TEXT("_"), TEXT("\\_"));
-					String = String.Replace(TEXT("`"), TEXT("\\`"));
-					String = String.Replace(TEXT(">"), TEXT("\\>"));
-					String = String.Replace(TEXT("|"), TEXT("\\|"));
-					DiscordMessage += String;
-				}
-				// Number
-				else if (FJsonValueNumber* NumValue = (FJsonValueNumber*)(ValuePtr))
-				{
-					DiscordMessage += FString::FromInt(StringValue->AsNumber());
-				}
-				// Boolean
-				else if (FJsonValueBoolean* BoolValue = (FJsonValueBoolean*)(ValuePtr))
-				{
-					DiscordMessage += (StringValue->AsBool()) ? TEXT("true") : TEXT("false");
-				}
-				else
-				{
-					DiscordMessage += TEXT("InvalidType");
-				}
-
-				// Line Terminator
-				DiscordMessage += LINE_TERMINATOR;
-			}
-
-			RootObject->SetStringField(TEXT("content"), "");
-			RootObject->SetStringField(TEXT("username"), ServerName);
-			//RootObject->SetStringField(TEXT("username"), DisplayName + TEXT(" (") + AlderonId + TEXT(")"));
-			//RootObject->SetStringField(TEXT("avatar_url"), AvatarUrl);
-			RootObject->SetBoolField(TEXT("tts"), false);
-
-			TSharedPtr<FJsonObject> Embed = MakeShareable(new FJsonObject);
-			Embed->SetStringField(TEXT("title"), WebhookKey);
-			Embed->SetStringField(TEXT("type"), TEXT("rich"));
-			Embed->SetStringField(TEXT("description"), DiscordMessage);
-			// date("c", strtotime("now"));
-			//Embed->SetStringField(TEXT("timestamp"), "");
-
-			TArray<TSharedPtr<FJsonValue>> Embeds;
-			Embeds.Add(MakeShared<FJsonValueObject>(Embed));
-			RootObject->SetArrayField(TEXT("embeds"), Embeds);
-		}
-		else
-		{
-			for (auto& Elem : Properties)
-			{
-				RootObject->SetField(Elem.Key, Elem.Value);
-			}
-		}
-
-		FString JsonResult;
-		auto Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonResult);
-		FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer);
-
-		UE_LOG(TitansLogParse, Verbose, TEXT("Webhook: Url: %s Json: %s"), *WebHookUrl, *JsonResult)
-
-		HttpRequest->SetContentAsString(JsonResult);
-		HttpRequest->SetURL(WebHookUrl);
-		HttpRequest->ProcessRequest();
-	}
-
-	// Log Information
-	{
-		FString LogLine = "";
-
-		for (auto& Elem : Properties)
-		{
-			// **PropertyName:** 
-			LogLine += Elem.Key + TEXT(": ");
-
-			// String
-			FJsonValue* ValuePtr = Elem.Value.Get();
-			if (FJsonValueString* StringValue = (FJsonValueString*)(ValuePtr))
-			{
-				LogLine += StringValue->AsString();
-			}
-			// Number
-			else if (FJsonValueNumber* NumValue = (FJsonValueNumber*)(ValuePtr))
-			{
-				LogLine += FString::FromInt(StringValue->AsNumber());
-			}
-			// Boolean
-			else if (FJsonValueBoolean* BoolValue = (FJsonValueBoolean*)(ValuePtr))
-			{
-				LogLine += (StringValue->AsBool()) ? TEXT("1") : TEXT("0");
-			}
-			else
-			{
-				LogLine += TEXT("InvalidType");
-			}
-
-			// Line Terminator
-			LogLine += TEXT(" ");
-		}
-
-		UE_LOG(TitansLogParse, Log, TEXT("%s"), *LogLine)
-	}
-}
-
-void AIGameSession::TriggerWebHook_Callback(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString WebHookKey)
-{
-	FString ResponseJson = TEXT("");
-	int32 ResponseCode = 0;
-
-	if (Response.IsValid())
-	{
-		ResponseCode = Response->GetResponseCode();
-		ResponseJson = Response->GetContentAsString();
-		UE_LOG(TitansNetwork, Log, TEXT("AIGameSession:TriggerWebHook_Callback: (%i) Key: %s Json: %s"), ResponseCode, *WebHookKey, *ResponseJson);
-	}
-
-	if (!bWasSuccessful || !Response.IsValid() || !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+	// Formatting, batching and sending all happen in the dispatcher, off the game thread where possible
+	if (UWebhookDispatcher* Dispatcher = UWebhookDispatcher::Get())
 	{
-		UE_LOG(TitansNetwork, Error, TEXT("AIGameSession:TriggerWebHook_Callback() Failed"));
-		return;
+		Dispatcher->Dispatch(WebhookKey, ServerName, Properties);
 	}
-
-	/*
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseJson);
-	if (FJsonSerializer::Deserialize(Reader, JsonObject))
+	else
 	{
-		if (JsonObject->HasField("data"))
-		{
-			TSharedPtr<FJsonObject> DataObject = JsonObject->GetObjectField("data");
-
-			FString ResultOtp = DataObject->GetStringField("otp");
-			FString ResultToken = DataObject->GetStringField("token");
+		FString WebHookUrl;
+		GConfig->GetString(TEXT("ServerWebhooks"), *WebhookKey, WebHookUrl, GGameIni);
 
-#if !UE_BUILD_SHIPPING
-			UE_LOG(AlderonLog, Log, TEXT("IAlderonAuth:ClientOTPCallback: Otp: %s Token: %s"), *ResultOtp, *ResultToken);
-#endif
-			OnCompleted.ExecuteIfBound(ResultOtp, ResultToken);
-			return;
-		}
+		UE_LOG(TitansNetwork, Log, TEXT("TriggerWebhook: Key: %s Url %s"), *WebhookKey, *WebHookUrl)
 	}
-	*/
 }
 
 bool AIGameSession::AtCapacity(bool bSpectator)
@@ -1673,54 +1923,199 @@ bool AIGameSession::IsPlayerWhitelisted(const FString& UniqueID)
 	return IsPlayerWhitelisted(FAlderonPlayerID(UniqueID));
 }
 
-FPlayerBan AIGameSession::GetBanInformation(const FAlderonPlayerID& AlderonId)
+void AIGameSession::RebuildBanIndex()
 {
-	for (const FPlayerBan& Ban : Bans)
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameSession::RebuildBanIndex"))
+
+	BanIdIndex.Reset();
+	BanIPIndex.Reset();
+	BanExpiryHeap.Reset();
+
+	BanIdIndex.Reserve(Bans.Num());
+
+	for (int32 BanIndex = 0; BanIndex < Bans.Num(); BanIndex++)
 	{
-		if (!Ban.PlayerId.IsValid()) continue;
+		AddBanToIndex(BanIndex);
+	}
+}
+
+void AIGameSession::AddBanToIndex(int32 BanIndex)
+{
+	const FPlayerBan& Ban = Bans[BanIndex];
+
+	// Expired bans stay in the file but are never looked up again
+	if (Ban.IsExpired())
+	{
+		return;
+	}
+
+	if (Ban.PlayerId.IsValid())
+	{
+		BanIdIndex.FindOrAdd(Ban.PlayerId.ToDisplayString()).Add(BanIndex);
+	}
+
+	if (!Ban.IPAddress.IsEmpty())
+	{
+		BanIPIndex.FindOrAdd(Ban.IPAddress).Add(BanIndex);
+	}
+
+	if (Ban.BanExpiration > 0)
+	{
+		BanExpiryHeap.HeapPush(FModerationExpiry{ Ban.BanExpiration, BanIndex });
+	}
+}
+
+void AIGameSession::PruneExpiredBans()
+{
+	if (BanExpiryHeap.Num() == 0)
+	{
+		return;
+	}
+
+	const uint64 Now = static_cast<uint64>(FDateTime::UtcNow().ToUnixTimestamp());
+
+	while (BanExpiryHeap.Num() > 0 && BanExpiryHeap.HeapTop().Expiration < Now)
+	{
+		FModerationExpiry Expired;
+		BanExpiryHeap.HeapPop(Expired, false);
+
+		const FPlayerBan& Ban = Bans[Expired.Index];
+		if (Ban.PlayerId.IsValid())
+		{
+			RemoveFromModerationIndex(BanIdIndex, Ban.PlayerId.ToDisplayString(), Expired.Index);
+		}
 
-		if (Ban.PlayerId == AlderonId && !Ban.IsExpired())
+		if (!Ban.IPAddress.IsEmpty())
 		{
-			return Ban;
+			RemoveFromModerationIndex(BanIPIndex, Ban.IPAddress, Expired.Index);
+		}
+	}
+}
+
+const FPlayerBan* AIGameSession::FindActiveBan(const FString& AlderonIdString)
+{
+	PruneExpiredBans();
+
+	if (const FModerationIndexList* Entries = BanIdIndex.Find(AlderonIdString))
+	{
+		for (const int32 BanIndex : *Entries)
+		{
+			const FPlayerBan& Ban = Bans[BanIndex];
+			if (!Ban.IsExpired())
+			{
+				return &Ban;
+			}
 		}
 	}
 
-	return FPlayerBan();
+	return nullptr;
 }
 
-FPlayerMute AIGameSession::GetServerMuteInformation(const FAlderonPlayerID& AlderonId)
+void AIGameSession::RebuildMuteIndex()
 {
-	for (const FPlayerMute& Mute : ServerMutes)
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIGameSession::RebuildMuteIndex"))
+
+	MuteIdIndex.Reset();
+	MuteExpiryHeap.Reset();
+
+	MuteIdIndex.Reserve(ServerMutes.Num());
+
+	for (int32 MuteIndex = 0; MuteIndex < ServerMutes.Num(); MuteIndex++)
 	{
-		if (!Mute.PlayerId.IsValid()) continue;
+		AddMuteToIndex(MuteIndex);
+	}
+}
 
-		if (Mute.PlayerId == AlderonId && !Mute.IsExpired())
+void AIGameSession::AddMuteToIndex(int32 MuteIndex)
+{
+	const FPlayerMute& Mute = ServerMutes[MuteIndex];
+
+	if (!Mute.PlayerId.IsValid() || Mute.IsExpired())
+	{
+		return;
+	}
+
+	MuteIdIndex.FindOrAdd(Mute.PlayerId.ToDisplayString()).Add(MuteIndex);
+
+	if (Mute.BanExpiration > 0)
+	{
+		MuteExpiryHeap.HeapPush(FModerationExpiry{ Mute.BanExpiration, MuteIndex });
+	}
+}
+
+void AIGameSession::PruneExpiredMutes()
+{
+	if (MuteExpiryHeap.Num() == 0)
+	{
+		return;
+	}
+
+	const uint64 Now = static_cast<uint64>(FDateTime::UtcNow().ToUnixTimestamp());
+
+	while (MuteExpiryHeap.Num() > 0 && MuteExpiryHeap.HeapTop().Expiration < Now)
+	{
+		FModerationExpiry Expired;
+		MuteExpiryHeap.HeapPop(Expired, false);
+
+		RemoveFromModerationIndex(MuteIdIndex, ServerMutes[Expired.Index].PlayerId.ToDisplayString(), Expired.Index);
+	}
+}
+
+const FPlayerMute* AIGameSession::FindActiveMute(const FString& AlderonIdString)
+{
+	PruneExpiredMutes();
+
+	if (const FModerationIndexList* Entries = MuteIdIndex.Find(AlderonIdString))
+	{
+		for (const int32 MuteIndex : *Entries)
 		{
-			return Mute;
+			const FPlayerMute& Mute = ServerMutes[MuteIndex];
+			if (!Mute.IsExpired())
+			{
+				return &Mute;
+			}
 		}
 	}
 
-	return FPlayerMute();
+	return nullptr;
+}
+
+FPlayerBan AIGameSession::GetBanInformation(const FAlderonPlayerID& AlderonId)
+{
+	if (!AlderonId.IsValid())
+	{
+		return FPlayerBan();
+	}
+
+	const FPlayerBan* Ban = FindActiveBan(AlderonId.ToDisplayString());
+	return Ban ? *Ban : FPlayerBan();
+}
+
+FPlayerMute AIGameSession::GetServerMuteInformation(const FAlderonPlayerID& AlderonId)
+{
+	if (!AlderonId.IsValid())
+	{
+		return FPlayerMute();
+	}
+
+	const FPlayerMute* Mute = FindActiveMute(AlderonId.ToDisplayString());
+	return Mute ? *Mute : FPlayerMute();
 }
 
 bool AIGameSession::IsPlayerBanned(const FAlderonPlayerID& AlderonId)
 {
-	if (IsAdminID(AlderonId.ToDisplayString()) || IsDevID(AlderonId.ToDisplayString()) || GetNetMode() == NM_Standalone)
+	if (GetNetMode() == NM_Standalone || !AlderonId.IsValid())
 	{
 		return false;
 	}
 
-	for (const FPlayerBan& Ban : Bans)
+	const FString AlderonIdString = AlderonId.ToDisplayString();
+	if (IsAdminID(AlderonIdString) || IsDevID(AlderonIdString))
 	{
-		if (!Ban.PlayerId.IsValid()) continue;
-
-		if (Ban.PlayerId == AlderonId && !Ban.IsExpired())
-		{
-			return true;
-		}
+		return false;
 	}
 
-	return false;
+	return FindActiveBan(AlderonIdString) != nullptr;
 }
 
 bool AIGameSession::IsPlayerWhitelisted(const FAlderonPlayerID& AlderonId)
@@ -1730,28 +2125,31 @@ bool AIGameSession::IsPlayerWhitelisted(const FAlderonPlayerID& AlderonId)
 
 bool AIGameSession::IsPlayerServerMuted(const FAlderonPlayerID& AlderonId)
 {
-	for (const FPlayerMute& Mute : ServerMutes)
+	if (!AlderonId.IsValid())
 	{
-		if (!Mute.PlayerId.IsValid()) continue;
-
-		if (Mute.PlayerId == AlderonId && !Mute.IsExpired())
-		{
-			return true;
-		}
+		return false;
 	}
 
-	return false;
+	return FindActiveMute(AlderonId.ToDisplayString()) != nullptr;
 }
 
 bool AIGameSession::IsIPAddressBanned(const FString& IPAddress)
 {
-	for (const FPlayerBan& Ban : Bans)
+	if (IPAddress.IsEmpty())
 	{
-		if (Ban.IPAddress.IsEmpty()) continue;
+		return false;
+	}
 
-		if (Ban.IPAddress == IPAddress && !Ban.IsExpired())
+	PruneExpiredBans();
+
+	if (const FModerationIndexList* Entries = BanIPIndex.Find(IPAddress))
+	{
+		for (const int32 BanIndex : *Entries)
 		{
-			return true;
+			if (!Bans[BanIndex].IsExpired())
+			{
+				return true;
+			}
 		}
 	}
 
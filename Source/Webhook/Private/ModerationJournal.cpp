@@ -0,0 +1,257 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#include "Online/ModerationJournal.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+FModerationJournal::FModerationJournal(const FString& InFileName)
+	: FileName(InFileName)
+{
+}
+
+FString FModerationJournal::GetFilePath() const
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), FileName);
+}
+
+bool FModerationJournal::Exists() const
+{
+	return FPaths::FileExists(GetFilePath());
+}
+
+bool FModerationJournal::IsComment(const FString& Line)
+{
+	return Line.StartsWith(TEXT("//")) || Line.StartsWith(TEXT(";"));
+}
+
+FString FModerationJournal::MakeRemovalRecord(const FString& Entry)
+{
+	// Replay compares trimmed entries, ParseRemovalRecord trims too
+	return TEXT("-") + Entry.TrimStartAndEnd();
+}
+
+bool FModerationJournal::ParseRemovalRecord(const FString& Line, FString& OutEntry)
+{
+	if (!Line.StartsWith(TEXT("-")))
+	{
+		return false;
+	}
+
+	OutEntry = Line.RightChop(1).TrimStartAndEnd();
+	return !OutEntry.IsEmpty();
+}
+
+FString FModerationJournal::GetEntryKey(const FString& Entry)
+{
+	int32 SeparatorIndex = INDEX_NONE;
+	if (Entry.FindChar(TEXT(':'), SeparatorIndex))
+	{
+		return Entry.Left(SeparatorIndex).TrimStartAndEnd();
+	}
+	return Entry;
+}
+
+int32 FModerationJournal::CountRecords(const TArray<FString>& Lines)
+{
+	int32 Count = 0;
+	for (const FString& Line : Lines)
+	{
+		if (!IsComment(Line))
+		{
+			Count++;
+		}
+	}
+	return Count;
+}
+
+bool FModerationJournal::ReadBytes(int64 Offset, TArray<uint8>& OutBytes) const
+{
+	OutBytes.Reset();
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*GetFilePath()));
+	if (!Reader)
+	{
+		return false;
+	}
+
+	const int64 FileSize = Reader->TotalSize();
+	if (Offset < FileSize)
+	{
+		Reader->Seek(Offset);
+		OutBytes.SetNumUninitialized(FileSize - Offset);
+		Reader->Serialize(OutBytes.GetData(), OutBytes.Num());
+	}
+
+	return Reader->Close();
+}
+
+void FModerationJournal::SetReadPosition(const TArray<uint8>& Bytes)
+{
+	// Bytes is the whole file
+	ReadOffset = Bytes.Num();
+	ReadChecksum = FCrc::MemCrc32(Bytes.GetData(), Bytes.Num());
+	bEndsWithNewline = Bytes.Num() == 0 || Bytes.Last() == '\n';
+}
+
+void FModerationJournal::RefreshReadPosition()
+{
+	TArray<uint8> Bytes;
+	ReadBytes(0, Bytes);
+	SetReadPosition(Bytes);
+}
+
+bool FModerationJournal::ReadAll(TArray<FString>& OutLines)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FModerationJournal::ReadAll"))
+
+	OutLines.Reset();
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetFilePath()))
+	{
+		return false;
+	}
+
+	bLegacyEncoding = Bytes.Num() >= 2 && ((Bytes[0] == 0xFF && Bytes[1] == 0xFE) || (Bytes[0] == 0xFE && Bytes[1] == 0xFF));
+
+	FString Text;
+	FFileHelper::BufferToString(Text, Bytes.GetData(), Bytes.Num());
+	Text.ParseIntoArrayLines(OutLines, true);
+
+	SetReadPosition(Bytes);
+	NumRecords = CountRecords(OutLines);
+
+	return true;
+}
+
+FModerationJournal::EReadResult FModerationJournal::ReadDelta(TArray<FString>& OutLines)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FModerationJournal::ReadDelta"))
+
+	OutLines.Reset();
+
+	if (bLegacyEncoding)
+	{
+		return ReadAll(OutLines) ? EReadResult::Full : EReadResult::Missing;
+	}
+
+	// The whole file is checksummed, an edit anywhere before the read offset must force a full reload.
+	// Reading the bytes is cheap next to parsing and applying every line again.
+	TArray<uint8> Bytes;
+	if (!ReadBytes(0, Bytes))
+	{
+		return EReadResult::Missing;
+	}
+
+	const int32 CheckedBytes = static_cast<int32>(ReadOffset);
+
+	// Shrunk, or the bytes we already parsed changed, the file was rewritten by someone else
+	if (Bytes.Num() < CheckedBytes || FCrc::MemCrc32(Bytes.GetData(), CheckedBytes) != ReadChecksum)
+	{
+		return ReadAll(OutLines) ? EReadResult::Full : EReadResult::Missing;
+	}
+
+	if (Bytes.Num() == CheckedBytes)
+	{
+		return EReadResult::Unchanged;
+	}
+
+	// Text added straight onto an unterminated last line means that line was edited
+	if (!bEndsWithNewline && Bytes[CheckedBytes] != '\n' && Bytes[CheckedBytes] != '\r')
+	{
+		return ReadAll(OutLines) ? EReadResult::Full : EReadResult::Missing;
+	}
+
+	const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Bytes.GetData() + CheckedBytes), Bytes.Num() - CheckedBytes);
+	const FString Text(Converter.Length(), Converter.Get());
+	Text.ParseIntoArrayLines(OutLines, true);
+
+	// Continue the checksum over the appended bytes rather than hashing the whole file again
+	ReadOffset = Bytes.Num();
+	ReadChecksum = FCrc::MemCrc32(Bytes.GetData() + CheckedBytes, Bytes.Num() - CheckedBytes, ReadChecksum);
+	bEndsWithNewline = Bytes.Last() == '\n';
+	NumRecords += CountRecords(OutLines);
+
+	return EReadResult::Delta;
+}
+
+bool FModerationJournal::Append(const FString& Record)
+{
+	return Append(TArray<FString>{ Record });
+}
+
+bool FModerationJournal::Append(const TArray<FString>& Records)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FModerationJournal::Append"))
+
+	// Callers fall back to a full rewrite, which also converts legacy files
+	if (bLegacyEncoding || !Exists())
+	{
+		return false;
+	}
+
+	if (Records.Num() == 0)
+	{
+		return true;
+	}
+
+	const FString FilePath = GetFilePath();
+	const int64 SizeBefore = IFileManager::Get().FileSize(*FilePath);
+
+	// If someone else appended since our last read we don't know how their last line ended
+	const bool bUpToDate = SizeBefore == ReadOffset;
+
+	FString Text;
+	if (SizeBefore > 0 && (!bUpToDate || !bEndsWithNewline))
+	{
+		Text += LINE_TERMINATOR;
+	}
+
+	for (const FString& Record : Records)
+	{
+		Text += Record;
+		Text += LINE_TERMINATOR;
+	}
+
+	if (!FFileHelper::SaveStringToFile(Text, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		return false;
+	}
+
+	// Otherwise the next delta read picks up both their records and ours
+	if (bUpToDate)
+	{
+		RefreshReadPosition();
+		NumRecords += Records.Num();
+	}
+
+	return true;
+}
+
+bool FModerationJournal::Rewrite(const TArray<FString>& Lines)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FModerationJournal::Rewrite"))
+
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *GetFilePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		return false;
+	}
+
+	bLegacyEncoding = false;
+	RefreshReadPosition();
+	NumRecords = CountRecords(Lines);
+
+	return true;
+}
+
+bool FModerationJournal::ShouldCompact(int32 NumLiveEntries, int32 MinDeadRecords) const
+{
+	if (bLegacyEncoding)
+	{
+		return true;
+	}
+
+	const int32 NumDeadRecords = NumRecords - NumLiveEntries;
+	return NumDeadRecords >= FMath::Max(MinDeadRecords, NumLiveEntries / 4);
+}
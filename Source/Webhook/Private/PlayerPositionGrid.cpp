@@ -0,0 +1,166 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#include "GameMode/PlayerPositionGrid.h"
+
+FPlayerPositionGrid::FPlayerPositionGrid(float InCellSize)
+{
+	SetCellSize(InCellSize);
+}
+
+void FPlayerPositionGrid::SetCellSize(float InCellSize)
+{
+	const float NewCellSize = FMath::Max(InCellSize, 100.0f);
+	if (NewCellSize != CellSize)
+	{
+		CellSize = NewCellSize;
+		Reset();
+	}
+}
+
+void FPlayerPositionGrid::Reset()
+{
+	// Keep the cell allocations around, the grid is refilled every frame with mostly the same cells.
+	for (TPair<FIntPoint, TArray<FVector, TInlineAllocator<4>>>& Cell : Cells)
+	{
+		Cell.Value.Reset();
+	}
+
+	NumPositions = 0;
+	MinCell = FIntPoint(MAX_int32, MAX_int32);
+	MaxCell = FIntPoint(MIN_int32, MIN_int32);
+}
+
+void FPlayerPositionGrid::Add(const FVector& Position)
+{
+	const FIntPoint Cell = GetCell(Position);
+	Cells.FindOrAdd(Cell).Add(Position);
+
+	MinCell = FIntPoint(FMath::Min(MinCell.X, Cell.X), FMath::Min(MinCell.Y, Cell.Y));
+	MaxCell = FIntPoint(FMath::Max(MaxCell.X, Cell.X), FMath::Max(MaxCell.Y, Cell.Y));
+	NumPositions++;
+}
+
+FIntPoint FPlayerPositionGrid::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+float FPlayerPositionGrid::FindNearestDistance(const FVector& Location) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FPlayerPositionGrid::FindNearestDistance"))
+
+	if (IsEmpty())
+	{
+		return TNumericLimits<float>::Max();
+	}
+
+	const FIntPoint Center = GetCell(Location);
+
+	// Past this ring there are no occupied cells left to visit.
+	const int32 MaxRing = FMath::Max(
+		FMath::Max(FMath::Abs(Center.X - MinCell.X), FMath::Abs(MaxCell.X - Center.X)),
+		FMath::Max(FMath::Abs(Center.Y - MinCell.Y), FMath::Abs(MaxCell.Y - Center.Y)));
+
+	float BestDistanceSquared = TNumericLimits<float>::Max();
+
+	for (int32 Ring = 0; Ring <= MaxRing; Ring++)
+	{
+		for (int32 Y = Center.Y - Ring; Y <= Center.Y + Ring; Y++)
+		{
+			if (Y < MinCell.Y || Y > MaxCell.Y)
+			{
+				continue;
+			}
+
+			// Interior rows only have the two edge cells on this ring.
+			const bool bEdgeRow = FMath::Abs(Y - Center.Y) == Ring;
+			const int32 Step = (bEdgeRow || Ring == 0) ? 1 : Ring * 2;
+
+			for (int32 X = Center.X - Ring; X <= Center.X + Ring; X += Step)
+			{
+				if (X < MinCell.X || X > MaxCell.X)
+				{
+					continue;
+				}
+
+				const TArray<FVector, TInlineAllocator<4>>* const CellPositions = Cells.Find(FIntPoint(X, Y));
+				if (!CellPositions)
+				{
+					continue;
+				}
+
+				for (const FVector& Position : *CellPositions)
+				{
+					BestDistanceSquared = FMath::Min(BestDistanceSquared, static_cast<float>(FVector::DistSquared(Location, Position)));
+				}
+			}
+		}
+
+		// Anything in a further ring is at least Ring cells away on one axis.
+		const float RingDistance = Ring * CellSize;
+		if (BestDistanceSquared <= RingDistance * RingDistance)
+		{
+			break;
+		}
+	}
+
+	return FMath::Sqrt(BestDistanceSquared);
+}
+
+template<typename FunctorType>
+bool FPlayerPositionGrid::ForEachInRadius(const FVector& Location, float Radius, FunctorType&& Functor) const
+{
+	if (IsEmpty() || Radius < 0.0f)
+	{
+		return false;
+	}
+
+	const FIntPoint Low = GetCell(Location - FVector(Radius, Radius, 0.0f));
+	const FIntPoint High = GetCell(Location + FVector(Radius, Radius, 0.0f));
+	const float RadiusSquared = Radius * Radius;
+
+	for (int32 Y = FMath::Max(Low.Y, MinCell.Y); Y <= FMath::Min(High.Y, MaxCell.Y); Y++)
+	{
+		for (int32 X = FMath::Max(Low.X, MinCell.X); X <= FMath::Min(High.X, MaxCell.X); X++)
+		{
+			const TArray<FVector, TInlineAllocator<4>>* const CellPositions = Cells.Find(FIntPoint(X, Y));
+			if (!CellPositions)
+			{
+				continue;
+			}
+
+			for (const FVector& Position : *CellPositions)
+			{
+				// Functor returns true to stop the search
+				if (FVector::DistSquared(Location, Position) <= RadiusSquared && Functor(Position))
+				{
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+int32 FPlayerPositionGrid::CountInRadius(const FVector& Location, float Radius) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FPlayerPositionGrid::CountInRadius"))
+
+	int32 Count = 0;
+	ForEachInRadius(Location, Radius, [&Count](const FVector&)
+	{
+		Count++;
+		return false;
+	});
+
+	return Count;
+}
+
+bool FPlayerPositionGrid::AnyInRadius(const FVector& Location, float Radius) const
+{
+	return ForEachInRadius(Location, Radius, [](const FVector&)
+	{
+		return true;
+	});
+}
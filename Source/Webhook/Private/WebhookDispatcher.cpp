@@ -0,0 +1,670 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#include "Online/WebhookDispatcher.h"
+#include "PathOfTitans/PathOfTitans.h"
+#include "AlderonCommon.h"
+#include "HttpModule.h"
+#include "HttpManager.h"
+#include "HAL/Event.h"
+#include "HAL/RunnableThread.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+// Discord allows 10 embeds and 6000 characters per message
+static constexpr int32 WebhookMaxEmbedsPerMessage = 10;
+static constexpr int32 WebhookMaxCharactersPerMessage = 5500;
+
+// Payloads waiting per key before the oldest are dropped
+static constexpr int32 WebhookMaxQueuedPayloadsPerKey = 256;
+
+// Attempts for a payload failing with a transport error or 5xx
+static constexpr int32 WebhookMaxAttempts = 5;
+static constexpr double WebhookMaxBackoffSeconds = 60.0;
+
+static const TCHAR* WebhookStandInUrl = TEXT("http://127.0.0.1/webhook-standin");
+
+UWebhookDispatcher* UWebhookDispatcher::Instance = nullptr;
+
+// Numbers and booleans convert to strings, anything else (objects, arrays, null) is invalid
+static bool GetWebhookValueString(const TSharedPtr<FJsonValue>& Value, FString& OutString)
+{
+	return Value.IsValid() && Value->TryGetString(OutString);
+}
+
+// Backslash discord format characters in one pass to prevent unintentional formatting
+static void AppendDiscordEscaped(FString& Out, const FString& In)
+{
+	Out.Reserve(Out.Len() + In.Len());
+
+	for (const TCHAR Character : In)
+	{
+		switch (Character)
+		{
+		case TEXT('*'):
+		case TEXT('~'):
+		case TEXT('_'):
+		case TEXT('`'):
+		case TEXT('>'):
+		case TEXT('|'):
+			Out.AppendChar(TEXT('\\'));
+			break;
+		default:
+			break;
+		}
+
+		Out.AppendChar(Character);
+	}
+}
+
+static FString SerializeWebhookJson(const TSharedRef<FJsonObject>& RootObject)
+{
+	FString JsonResult;
+	auto Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonResult);
+	FJsonSerializer::Serialize(RootObject, Writer);
+	return JsonResult;
+}
+
+FWebhookFormatWorker::FWebhookFormatWorker(float InBatchWindowSeconds)
+	: BatchWindowSeconds(FMath::Max(InBatchWindowSeconds, 0.0f))
+{
+	WorkEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	Thread = FRunnableThread::Create(this, TEXT("FWebhookFormatWorker"), 0U, TPri_BelowNormal);
+}
+
+FWebhookFormatWorker::~FWebhookFormatWorker()
+{
+	ShutDown();
+}
+
+uint32 FWebhookFormatWorker::Run()
+{
+	while (StopTaskCounter.GetValue() == 0)
+	{
+		FWebhookEvent Event;
+		while (StopTaskCounter.GetValue() == 0 && EventQueue.Dequeue(Event))
+		{
+			FormatEvent(Event);
+		}
+
+		const bool bHasOpenBatches = FlushBatches(FlushRequested.Set(0) != 0);
+
+		// Open batches need to be looked at again once their window runs out
+		WorkEvent->Wait(FTimespan::FromSeconds(bHasOpenBatches ? 0.05 : 1.0));
+	}
+
+	return 0;
+}
+
+void FWebhookFormatWorker::Stop()
+{
+	StopTaskCounter.Increment();
+
+	if (WorkEvent)
+	{
+		WorkEvent->Trigger();
+	}
+}
+
+void FWebhookFormatWorker::ShutDown()
+{
+	if (Thread)
+	{
+		Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	if (WorkEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+		WorkEvent = nullptr;
+	}
+}
+
+void FWebhookFormatWorker::Enqueue(FWebhookEvent&& Event)
+{
+	PendingEvents.Increment();
+	EventQueue.Enqueue(MoveTemp(Event));
+	WorkEvent->Trigger();
+}
+
+bool FWebhookFormatWorker::DequeuePayload(FWebhookPayload& OutPayload)
+{
+	return PayloadQueue.Dequeue(OutPayload);
+}
+
+void FWebhookFormatWorker::RequestFlush()
+{
+	FlushRequested.Set(1);
+	WorkEvent->Trigger();
+}
+
+void FWebhookFormatWorker::FormatEvent(FWebhookEvent& Event)
+{
+	// Log Information
+	if (Event.bWriteLogLine)
+	{
+		FString LogLine = "";
+
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Elem : Event.Properties)
+		{
+			FString ValueString;
+			LogLine += Elem.Key + TEXT(": ");
+			LogLine += GetWebhookValueString(Elem.Value, ValueString) ? ValueString : TEXT("InvalidType");
+			LogLine += TEXT(" ");
+		}
+
+		UE_LOG(TitansLogParse, Log, TEXT("%s"), *LogLine)
+	}
+
+	if (Event.Endpoint.Url.IsEmpty())
+	{
+		PendingEvents.Decrement();
+		return;
+	}
+
+	if (!Event.Endpoint.bDiscord)
+	{
+		TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Elem : Event.Properties)
+		{
+			RootObject->SetField(Elem.Key, Elem.Value);
+		}
+
+		FWebhookPayload Payload;
+		Payload.Key = MoveTemp(Event.Key);
+		Payload.Url = MoveTemp(Event.Endpoint.Url);
+		Payload.Body = SerializeWebhookJson(RootObject);
+		Payload.NumEvents = 1;
+
+		UE_LOG(TitansLogParse, Verbose, TEXT("Webhook: Url: %s Json: %s"), *Payload.Url, *Payload.Body)
+
+		PayloadQueue.Enqueue(MoveTemp(Payload));
+		PendingEvents.Decrement();
+		return;
+	}
+
+	FString Description;
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Elem : Event.Properties)
+	{
+		// **PropertyName:**
+		Description += TEXT("**") + Elem.Key + TEXT(":** ");
+
+		FString ValueString;
+		if (GetWebhookValueString(Elem.Value, ValueString))
+		{
+			AppendDiscordEscaped(Description, ValueString);
+		}
+		else
+		{
+			Description += TEXT("InvalidType");
+		}
+
+		Description += LINE_TERMINATOR;
+	}
+
+	const int32 EmbedCharacters = Description.Len() + Event.Key.Len();
+
+	FPendingBatch& Batch = Batches.FindOrAdd(Event.Key);
+	if (Batch.Descriptions.Num() > 0
+		&& (Batch.Descriptions.Num() >= WebhookMaxEmbedsPerMessage
+			|| Batch.NumCharacters + EmbedCharacters > WebhookMaxCharactersPerMessage
+			|| Batch.Url != Event.Endpoint.Url))
+	{
+		FlushBatch(Event.Key, Batch);
+	}
+
+	if (Batch.Descriptions.Num() == 0)
+	{
+		Batch.Url = MoveTemp(Event.Endpoint.Url);
+		Batch.Username = MoveTemp(Event.Username);
+		Batch.FirstEventTime = FPlatformTime::Seconds();
+	}
+
+	Batch.Descriptions.Add(MoveTemp(Description));
+	Batch.NumCharacters += EmbedCharacters;
+}
+
+void FWebhookFormatWorker::FlushBatch(const FString& Key, FPendingBatch& Batch)
+{
+	if (Batch.Descriptions.Num() == 0)
+	{
+		return;
+	}
+
+	TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+	RootObject->SetStringField(TEXT("content"), "");
+	RootObject->SetStringField(TEXT("username"), Batch.Username);
+	RootObject->SetBoolField(TEXT("tts"), false);
+
+	TArray<TSharedPtr<FJsonValue>> Embeds;
+	Embeds.Reserve(Batch.Descriptions.Num());
+
+	for (const FString& Description : Batch.Descriptions)
+	{
+		TSharedPtr<FJsonObject> Embed = MakeShareable(new FJsonObject);
+		Embed->SetStringField(TEXT("title"), Key);
+		Embed->SetStringField(TEXT("type"), TEXT("rich"));
+		Embed->SetStringField(TEXT("description"), Description);
+		Embeds.Add(MakeShared<FJsonValueObject>(Embed));
+	}
+
+	RootObject->SetArrayField(TEXT("embeds"), Embeds);
+
+	FWebhookPayload Payload;
+	Payload.Key = Key;
+	Payload.Url = Batch.Url;
+	Payload.Body = SerializeWebhookJson(RootObject);
+	Payload.NumEvents = Batch.Descriptions.Num();
+
+	UE_LOG(TitansLogParse, Verbose, TEXT("Webhook: Url: %s Json: %s"), *Payload.Url, *Payload.Body)
+
+	// Queue before dropping the count so Flush never misses a payload in between
+	const int32 NumEvents = Payload.NumEvents;
+	PayloadQueue.Enqueue(MoveTemp(Payload));
+	PendingEvents.Subtract(NumEvents);
+
+	// Keep the allocations, the same keys tend to fire again
+	Batch.Descriptions.Reset();
+	Batch.NumCharacters = 0;
+}
+
+bool FWebhookFormatWorker::FlushBatches(bool bForce)
+{
+	const double Now = FPlatformTime::Seconds();
+	bool bHasOpenBatches = false;
+
+	for (TPair<FString, FPendingBatch>& Pair : Batches)
+	{
+		FPendingBatch& Batch = Pair.Value;
+		if (Batch.Descriptions.Num() > 0 && (bForce || Now - Batch.FirstEventTime >= BatchWindowSeconds))
+		{
+			FlushBatch(Pair.Key, Batch);
+		}
+
+		bHasOpenBatches |= Batch.Descriptions.Num() > 0;
+	}
+
+	return bHasOpenBatches;
+}
+
+UWebhookDispatcher* UWebhookDispatcher::Get()
+{
+	return Instance;
+}
+
+void UWebhookDispatcher::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Instance = this;
+	ReloadConfig();
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UWebhookDispatcher::Tick));
+}
+
+void UWebhookDispatcher::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	if (Worker)
+	{
+		// Restart and shutdown webhooks are fired right before exit, give them a chance to go out
+		Flush();
+
+		Worker->ShutDown();
+		Worker.Reset();
+	}
+
+	if (Instance == this)
+	{
+		Instance = nullptr;
+	}
+
+	Super::Deinitialize();
+}
+
+void UWebhookDispatcher::ReloadConfig()
+{
+	bEnabled = false;
+	GConfig->GetBool(TEXT("ServerWebhooks"), TEXT("bEnabled"), bEnabled, GGameIni);
+
+	FString WebhookFormat;
+	GConfig->GetString(TEXT("ServerWebhooks"), TEXT("Format"), WebhookFormat, GGameIni);
+	bDiscordFormat = WebhookFormat.Equals(TEXT("discord"), ESearchCase::IgnoreCase);
+
+	BatchWindowSeconds = 1.0f;
+	GConfig->GetFloat(TEXT("ServerWebhooks"), TEXT("BatchWindowSeconds"), BatchWindowSeconds, GGameIni);
+
+	// Urls are looked up again on first use
+	Endpoints.Reset();
+}
+
+const FWebhookEndpoint& UWebhookDispatcher::GetEndpoint(const FString& Key)
+{
+	if (const FWebhookEndpoint* Endpoint = Endpoints.Find(Key))
+	{
+		return *Endpoint;
+	}
+
+	FWebhookEndpoint& Endpoint = Endpoints.Add(Key);
+	GConfig->GetString(TEXT("ServerWebhooks"), *Key, Endpoint.Url, GGameIni);
+	Endpoint.bDiscord = bDiscordFormat;
+	return Endpoint;
+}
+
+void UWebhookDispatcher::Dispatch(const FString& Key, const FString& Username, const FWebhookProperties& Properties)
+{
+	check(IsInGameThread());
+
+	if (!Worker)
+	{
+		Worker = MakeUnique<FWebhookFormatWorker>(BatchWindowSeconds);
+	}
+
+	FWebhookEvent Event;
+	Event.Key = Key;
+	Event.Username = Username;
+	Event.Endpoint = GetEndpoint(Key);
+	Event.Properties = Properties;
+
+	UE_LOG(TitansNetwork, Verbose, TEXT("TriggerWebhook: Key: %s Url %s"), *Key, *Event.Endpoint.Url)
+
+	Worker->Enqueue(MoveTemp(Event));
+}
+
+bool UWebhookDispatcher::Flush(float TimeoutSeconds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UWebhookDispatcher::Flush"))
+
+	check(IsInGameThread());
+
+	if (!Worker)
+	{
+		return true;
+	}
+
+	FHttpManager& HttpManager = FHttpModule::Get().GetHttpManager();
+	const double Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+
+	while (HasPendingPayloads())
+	{
+		if (FPlatformTime::Seconds() >= Deadline)
+		{
+			UE_LOG(TitansNetwork, Warning, TEXT("UWebhookDispatcher::Flush: Timed out after %.1fs with %d events still being formatted"), TimeoutSeconds, Worker->GetNumPendingEvents());
+			return false;
+		}
+
+		Worker->RequestFlush();
+		Tick(0.0f);
+
+		// Completes requests in flight, their callbacks release the key for the next payload
+		HttpManager.Tick(0.0f);
+		FPlatformProcess::Sleep(0.001f);
+	}
+
+	return true;
+}
+
+bool UWebhookDispatcher::HasPendingPayloads() const
+{
+	if (Worker && Worker->GetNumPendingEvents() > 0)
+	{
+		return true;
+	}
+
+	for (const TPair<FString, FWebhookKeyState>& Pair : KeyStates)
+	{
+		if (Pair.Value.bInFlight || Pair.Value.Queue.Num() > 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool UWebhookDispatcher::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UWebhookDispatcher::Tick"))
+
+	if (!Worker)
+	{
+		return true;
+	}
+
+	FWebhookPayload Payload;
+	while (Worker->DequeuePayload(Payload))
+	{
+		FWebhookKeyState& State = KeyStates.FindOrAdd(Payload.Key);
+
+		// Never drop the request that is in flight
+		const int32 DropIndex = State.bInFlight ? 1 : 0;
+		if (State.Queue.Num() >= WebhookMaxQueuedPayloadsPerKey && State.Queue.IsValidIndex(DropIndex))
+		{
+			UE_LOG(TitansNetwork, Warning, TEXT("UWebhookDispatcher: Dropping oldest %s payload, too many queued"), *Payload.Key)
+			NumEventsDropped += State.Queue[DropIndex].NumEvents;
+			State.Queue.RemoveAt(DropIndex);
+		}
+
+		State.Queue.Add(MoveTemp(Payload));
+	}
+
+	const double Now = FPlatformTime::Seconds();
+
+	for (TPair<FString, FWebhookKeyState>& Pair : KeyStates)
+	{
+		FWebhookKeyState& State = Pair.Value;
+		if (!State.bInFlight && State.Queue.Num() > 0 && Now >= State.RetryAt)
+		{
+			SendNext(Pair.Key, State);
+		}
+	}
+
+	return true;
+}
+
+void UWebhookDispatcher::SendNext(const FString& Key, FWebhookKeyState& State)
+{
+	const FWebhookPayload& Payload = State.Queue[0];
+
+	// Benchmark payloads still in the worker when BenchmarkThroughput gave up must never reach the network
+	if (!StandInTransport && Payload.Url == WebhookStandInUrl)
+	{
+		NumEventsDropped += Payload.NumEvents;
+		State.Queue.RemoveAt(0);
+		return;
+	}
+
+	State.bInFlight = true;
+	NumRequestsSent++;
+
+	if (StandInTransport && Payload.Url == WebhookStandInUrl)
+	{
+		float RetryAfterSeconds = 0.0f;
+		const int32 ResponseCode = StandInTransport(Payload, RetryAfterSeconds);
+		HandleResponse(Key, ResponseCode, RetryAfterSeconds, 0.0f);
+		return;
+	}
+
+	FHttpRequestPtr HttpRequest = IAlderonCommon::CreateRequest(EAlderonWebRequestVerb::POST);
+	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UWebhookDispatcher::OnRequestComplete, Key);
+	HttpRequest->SetContentAsString(Payload.Body);
+	HttpRequest->SetURL(Payload.Url);
+	HttpRequest->ProcessRequest();
+}
+
+void UWebhookDispatcher::OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString Key)
+{
+	int32 ResponseCode = 0;
+	float RetryAfterSeconds = 0.0f;
+	float RateLimitResetSeconds = 0.0f;
+
+	if (bWasSuccessful && Response.IsValid())
+	{
+		ResponseCode = Response->GetResponseCode();
+		UE_LOG(TitansNetwork, Verbose, TEXT("UWebhookDispatcher::OnRequestComplete: (%i) Key: %s Json: %s"), ResponseCode, *Key, *Response->GetContentAsString());
+
+		if (ResponseCode == EHttpResponseCodes::TooManyRequests)
+		{
+			RetryAfterSeconds = FCString::Atof(*Response->GetHeader(TEXT("Retry-After")));
+
+			// Discord also reports it in the body
+			TSharedPtr<FJsonObject> JsonObject;
+			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+			double BodyRetryAfter = 0.0;
+			if (RetryAfterSeconds <= 0.0f && FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid() && JsonObject->TryGetNumberField(TEXT("retry_after"), BodyRetryAfter))
+			{
+				RetryAfterSeconds = static_cast<float>(BodyRetryAfter);
+			}
+		}
+
+		// Out of requests for this bucket, hold the key until it resets instead of eating a 429
+		if (Response->GetHeader(TEXT("X-RateLimit-Remaining")) == TEXT("0"))
+		{
+			RateLimitResetSeconds = FCString::Atof(*Response->GetHeader(TEXT("X-RateLimit-Reset-After")));
+		}
+	}
+
+	HandleResponse(Key, ResponseCode, RetryAfterSeconds, RateLimitResetSeconds);
+}
+
+void UWebhookDispatcher::HandleResponse(const FString& Key, int32 ResponseCode, float RetryAfterSeconds, float RateLimitResetSeconds)
+{
+	FWebhookKeyState* State = KeyStates.Find(Key);
+	if (!State || State->Queue.Num() == 0)
+	{
+		return;
+	}
+
+	State->bInFlight = false;
+
+	const double Now = FPlatformTime::Seconds();
+	FWebhookPayload& Payload = State->Queue[0];
+
+	if (ResponseCode == EHttpResponseCodes::TooManyRequests)
+	{
+		// Rate limited requests are retried as they are, they don't count as a failed attempt
+		NumRateLimited++;
+		State->RetryAt = Now + (RetryAfterSeconds > 0.0f ? RetryAfterSeconds : 1.0f);
+		UE_LOG(TitansNetwork, Verbose, TEXT("UWebhookDispatcher: %s rate limited, retrying in %.2fs"), *Key, State->RetryAt - Now)
+		return;
+	}
+
+	if (EHttpResponseCodes::IsOk(ResponseCode))
+	{
+		NumEventsDelivered += Payload.NumEvents;
+		State->Queue.RemoveAt(0);
+		State->ConsecutiveFailures = 0;
+		State->RetryAt = RateLimitResetSeconds > 0.0f ? Now + RateLimitResetSeconds : 0.0;
+		return;
+	}
+
+	Payload.NumAttempts++;
+
+	// Transport errors and server errors are worth another try, anything else is our request being wrong
+	const bool bTransient = ResponseCode == 0 || ResponseCode >= 500;
+	if (bTransient && Payload.NumAttempts < WebhookMaxAttempts)
+	{
+		State->ConsecutiveFailures++;
+		State->RetryAt = Now + FMath::Min<double>(FMath::Pow(2.0f, static_cast<float>(State->ConsecutiveFailures - 1)), WebhookMaxBackoffSeconds);
+		UE_LOG(TitansNetwork, Warning, TEXT("UWebhookDispatcher: %s failed (%i), retrying in %.0fs"), *Key, ResponseCode, State->RetryAt - Now)
+		return;
+	}
+
+	UE_LOG(TitansNetwork, Error, TEXT("UWebhookDispatcher: Dropping %s payload (%i) after %i attempts"), *Key, ResponseCode, Payload.NumAttempts)
+	NumEventsDropped += Payload.NumEvents;
+	State->Queue.RemoveAt(0);
+	State->ConsecutiveFailures = 0;
+	State->RetryAt = 0.0;
+}
+
+FString UWebhookDispatcher::BenchmarkThroughput(int32 NumEvents)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("UWebhookDispatcher::BenchmarkThroughput"))
+
+	NumEvents = FMath::Max(NumEvents, 1);
+	constexpr int32 NumKeys = 4;
+
+	if (!Worker)
+	{
+		Worker = MakeUnique<FWebhookFormatWorker>(BatchWindowSeconds);
+	}
+
+	TArray<FString> Keys;
+	for (int32 KeyIndex = 0; KeyIndex < NumKeys; KeyIndex++)
+	{
+		const FString& Key = Keys.Add_GetRef(FString::Printf(TEXT("WebhookBenchmark%d"), KeyIndex));
+		FWebhookEndpoint& Endpoint = Endpoints.Add(Key);
+		Endpoint.Url = WebhookStandInUrl;
+		Endpoint.bDiscord = true;
+	}
+
+	const int32 StartRequests = NumRequestsSent;
+	const int32 StartRateLimited = NumRateLimited;
+	const int32 StartDelivered = NumEventsDelivered;
+	const int32 StartDropped = NumEventsDropped;
+
+	// Every fifth request is rate limited like Discord does under load
+	int32 StandInRequests = 0;
+	StandInTransport = [&StandInRequests](const FWebhookPayload& Payload, float& OutRetryAfterSeconds)
+	{
+		if (++StandInRequests % 5 == 0)
+		{
+			OutRetryAfterSeconds = 0.01f;
+			return static_cast<int32>(EHttpResponseCodes::TooManyRequests);
+		}
+		return static_cast<int32>(EHttpResponseCodes::NoContent);
+	};
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	for (int32 EventIndex = 0; EventIndex < NumEvents; EventIndex++)
+	{
+		FWebhookEvent Event;
+		Event.Key = Keys[EventIndex % NumKeys];
+		Event.Username = TEXT("Benchmark");
+		Event.Endpoint = Endpoints.FindChecked(Event.Key);
+		Event.Properties.Add(TEXT("Killer"), MakeShared<FJsonValueString>(TEXT("Player_*One*")));
+		Event.Properties.Add(TEXT("Victim"), MakeShared<FJsonValueString>(TEXT("Player_`Two`")));
+		Event.Properties.Add(TEXT("Index"), MakeShared<FJsonValueNumber>(EventIndex));
+		Event.bWriteLogLine = false;
+		Worker->Enqueue(MoveTemp(Event));
+	}
+
+	const double EnqueueSeconds = FPlatformTime::Seconds() - StartTime;
+	// Runs on the game thread from a chat command, keep the stall short
+	const double Deadline = StartTime + 5.0;
+
+	while ((NumEventsDelivered - StartDelivered) + (NumEventsDropped - StartDropped) < NumEvents && FPlatformTime::Seconds() < Deadline)
+	{
+		Worker->RequestFlush();
+		Tick(0.0f);
+		FPlatformProcess::Sleep(0.001f);
+	}
+
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+	StandInTransport = nullptr;
+	for (const FString& Key : Keys)
+	{
+		Endpoints.Remove(Key);
+		KeyStates.Remove(Key);
+	}
+
+	const int32 Delivered = NumEventsDelivered - StartDelivered;
+
+	const FString Summary = FString::Printf(TEXT("WebhookDispatcher: %d events over %d keys in %.3fms (%.0f events/s, enqueue %.3fms). Requests: %d Rate limited: %d Delivered: %d Dropped: %d"),
+		NumEvents, NumKeys, ElapsedSeconds * 1000.0, Delivered / FMath::Max(ElapsedSeconds, 0.000001), EnqueueSeconds * 1000.0,
+		NumRequestsSent - StartRequests, NumRateLimited - StartRateLimited, Delivered, NumEventsDropped - StartDropped);
+
+	UE_LOG(TitansNetwork, Log, TEXT("UWebhookDispatcher::BenchmarkThroughput: %s"), *Summary);
+
+	return Summary;
+}
@@ -8,6 +8,7 @@
 #include "AlderonDatabaseBase.h"
 #include "ChatCommands/IChatCommand.h"
 #include "CaveSystem/IPlayerCaveMain.h"
+#include "GameMode/PlayerPositionGrid.h"
 #include "IGameMode.generated.h"
 
 class AICharSelectPoint;
@@ -48,6 +49,22 @@ struct FSpawnPointParameters
 
 DECLARE_DELEGATE_OneParam(FAsyncOperationCompleted, bool);
 
+// Snapshot of one priority level of the SaveAll queue
+struct FSaveQueueMetrics
+{
+	// Saves waiting to be dispatched
+	int32 Queued = 0;
+
+	// Requests merged into a save that was already queued for the same character
+	int32 Coalesced = 0;
+
+	// Saves handed to the database since startup
+	int32 Dispatched = 0;
+
+	// How long the oldest queued save has been waiting
+	float OldestWaitSeconds = 0.0f;
+};
+
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FAsyncCharacterCreated, const AIPlayerController*, PlayerController, FAlderonUID, CharacterUID);
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FAsyncCharacterSpawned, const AIPlayerController*, PlayerController, const AIBaseCharacter*, Character);
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FAsyncCharacterDeleted, const AIPlayerController*, PlayerController, bool, bSuccess);
@@ -138,6 +155,8 @@ protected:
 
 	virtual void StartPlay() override;
 
+	virtual void Tick(float DeltaSeconds) override;
+
 	virtual void PreLogin(const FString& Options, const FString& Address, const FUniqueNetIdRepl& UniqueId, FString& ErrorMessage) override;
 
 	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
@@ -385,11 +404,63 @@ public:
 	void SubmitCharacterData(AIPlayerState* IPlayerState);
 	void OnCharacterDataLoaded(AIPlayerState* IPlayerState, UCharacterDataAsset* CharacterDataAsset, FAlderonUID CharacterUID, FCharacterData CharacterData);
 
+	// High priority saves are dispatched immediately, lower priorities are queued, coalesced per character
+	// and dispatched over the following frames within SaveQueueFrameBudgetMs.
 	UFUNCTION(BlueprintCallable, Category = Database)
 	void SaveAll(AIPlayerController* PlayerController, const ESavePriority Priority = ESavePriority::Low);
 	void SaveAllAsync(AIPlayerController* PlayerController, FAsyncOperationCompleted OnCompleted, const ESavePriority Priority = ESavePriority::Low);
 
-	void PrepareCharacterForSave(AIBaseCharacter* TargetCharacter);
+	// Dispatches every queued save, regardless of the frame budget
+	void FlushSaveQueue();
+
+	FSaveQueueMetrics GetSaveQueueMetrics(const ESavePriority Priority) const;
+
+	// Time per frame spent dispatching queued saves
+	UPROPERTY(config)
+	float SaveQueueFrameBudgetMs = 2.0f;
+
+	// Queued saves waiting on an in-flight write for the same character are dispatched anyway after this long
+	UPROPERTY(config)
+	float SaveQueueMaxDeferSeconds = 30.0f;
+
+private:
+	struct FQueuedPlayerSave
+	{
+		TWeakObjectPtr<AIPlayerController> PlayerController;
+		TWeakObjectPtr<AIBaseCharacter> Character;
+		ESavePriority Priority = ESavePriority::Low;
+		double QueuedTime = 0.0;
+		TArray<FAsyncOperationCompleted, TInlineAllocator<1>> Callbacks;
+	};
+
+	static constexpr int32 NumSaveQueues = 3;
+	static int32 GetSaveQueueIndex(const ESavePriority Priority);
+
+	TMap<FAlderonUID, FQueuedPlayerSave> QueuedPlayerSaves;
+
+	// Character ids in dispatch order, most urgent queue first
+	TArray<FAlderonUID> SaveQueues[NumSaveQueues];
+	int32 SaveQueueCoalesced[NumSaveQueues] = {};
+	int32 SaveQueueDispatched[NumSaveQueues] = {};
+
+	void ProcessSaveQueue(const bool bFlushAll);
+	void DispatchQueuedSave(FQueuedPlayerSave&& QueuedSave);
+
+	// The queue only holds a weak pointer to the character, so its save is dispatched before the character is gone
+	UFUNCTION()
+	void OnQueuedSaveCharacterDestroyed(AActor* DestroyedActor);
+
+	void DispatchSaveAll(AIPlayerController* PlayerController, FAsyncOperationCompleted OnCompleted, const ESavePriority Priority, const bool bQuestsSerialized = false);
+
+	// Takes the character's queued save out of the queue, returns OnCompleted chained with the queued save's callbacks
+	FAsyncOperationCompleted TakeOverQueuedSave(AIBaseCharacter* IBaseCharacter, FAsyncOperationCompleted OnCompleted);
+
+	static FAsyncOperationCompleted CombineSaveCallbacks(TArray<FAsyncOperationCompleted, TInlineAllocator<1>>&& Callbacks);
+
+public:
+
+	// bQuestsSerialized if the character's quest saves were already filled in, see SaveAllPlayers
+	void PrepareCharacterForSave(AIBaseCharacter* TargetCharacter, const bool bQuestsSerialized = false);
 
 	void SaveCombatLogAI(AIBaseCharacter* CombatLogAI, bool bDestroyWhenDone = false);
 
@@ -399,7 +470,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Database)
 	void SaveCharacter(AIBaseCharacter* TargetCharacter, const ESavePriority Priority = ESavePriority::Low);
 
-	void SaveCharacterAsync(AIBaseCharacter* TargetCharacter, FAsyncOperationCompleted OnCompleted, const ESavePriority Priority = ESavePriority::Low);
+	void SaveCharacterAsync(AIBaseCharacter* TargetCharacter, FAsyncOperationCompleted OnCompleted, const ESavePriority Priority = ESavePriority::Low, const bool bQuestsSerialized = false);
 
 	// if bSaveAllCreatorModeObjects = true, then all creator objects will be saved regardless of being dirty
 	UPROPERTY(Config, BlueprintReadOnly)
@@ -446,7 +517,8 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Database)
 	void DeleteNest(AINest* Nest);
 
-	// Called on Shutdown to save all the players in the game
+	// Called on Shutdown to save all the players in the game.
+	// Their quests are serialized in parallel on worker threads while the game thread waits, then every character and player state is handed to the database.
 	bool SaveAllPlayers();
 	bool SaveAllNests();
 
@@ -537,6 +609,10 @@ public:
 	UPROPERTY(config, BlueprintReadOnly, EditDefaultsOnly, Category = GameMode)
 	float ExcludeSpawnNearDeathRadius = 100000.0f; 
 
+	// Cell size of the player position grid used to score spawn points
+	UPROPERTY(config, BlueprintReadOnly, EditDefaultsOnly, Category = GameMode)
+	float PlayerPositionGridCellSize = 25000.0f;
+
 	/************************************************************************/
 	/* Dinosaur Server Options                                              */
 	/************************************************************************/
@@ -549,7 +625,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = GameMode)
 	TArray<class APlayerStart*> GetSpawnPointsWithTag(FName SpawnTag) const;
 
+	// Registers a spawn point created after InitGame, e.g. by creator mode. Spawned APlayerStarts are picked up automatically.
+	UFUNCTION(BlueprintCallable, Category = GameMode)
+	void RegisterSpawnPoint(APlayerStart* PlayerStart);
+
+	UFUNCTION(BlueprintCallable, Category = GameMode)
+	void UnregisterSpawnPoint(APlayerStart* PlayerStart);
+
+	// Call after changing the tags of a registered spawn point
+	UFUNCTION(BlueprintCallable, Category = GameMode)
+	void RefreshSpawnPointTags(APlayerStart* PlayerStart);
+
 	float GetDistanceToClosestPlayer(FVector TargetLocation);
+
+	// Positions of every player pawn and combat log AI, rebuilt at most once per frame
+	const FPlayerPositionGrid& GetPlayerPositionGrid();
 	
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = GameMode)
 	FTransform FindRandomSpawnPointWithParams(const FSpawnPointParameters& Params);
@@ -585,6 +675,38 @@ public:
 private:
 	bool ValidatePotentialSpawnPoint(const APlayerStart* PlayerStart, const APlayerStart* FurthestPlayerStart);
 
+	// Tag -> spawn points carrying it, either as PlayerStartTag or in AnyPlayerStartTags
+	TMap<FName, TArray<class APlayerStart*>> SpawnPointTagIndex;
+
+	// Tags each spawn point was indexed under, its own tags may have changed since
+	TMap<class APlayerStart*, TArray<FName, TInlineAllocator<4>>> SpawnPointIndexedTags;
+
+	void RebuildSpawnPointTagIndex();
+	void AddSpawnPointToTagIndex(APlayerStart* PlayerStart);
+	void RemoveSpawnPointFromTagIndex(APlayerStart* PlayerStart);
+
+	// Returns nullptr if no spawn point carries SpawnTag
+	const TArray<class APlayerStart*>* FindSpawnPointsWithTag(FName SpawnTag) const;
+
+	void OnActorSpawned(AActor* SpawnedActor);
+
+	UFUNCTION()
+	void OnSpawnPointDestroyed(AActor* DestroyedActor);
+
+	FDelegateHandle ActorSpawnedHandle;
+
+	// Reference implementation of GetDistanceToClosestPlayer, kept for BenchmarkPlayerPositionGrid
+	float GetDistanceToClosestPlayerLinear(const FVector& TargetLocation) const;
+
+	void RefreshPlayerPositionGrid();
+
+	FPlayerPositionGrid PlayerPositionGrid;
+	uint64 PlayerPositionGridFrame = MAX_uint64;
+
+public:
+	// Times spawn point scoring with the linear scan and with the grid, returns a summary for the caller
+	FString BenchmarkPlayerPositionGrid(int32 Iterations);
+
 protected:
 	UPROPERTY()
 	AICharSelectPoint* CharSelectPoint;
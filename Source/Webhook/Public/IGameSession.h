@@ -6,6 +6,7 @@
 #include "Online.h"
 #include "IOnlineGameSettings.h"
 #include "ITypes.h"
+#include "Online/ModerationJournal.h"
 #include "IGameSession.generated.h"
 
 DECLARE_DELEGATE(FGameSessionReady);
@@ -79,6 +80,18 @@ public:
 	void FromString(const FString Line);
 };
 
+// Ban / mute expiry kept in a min-heap so expired entries can be dropped from the lookup indexes without a full scan
+struct FModerationExpiry
+{
+	uint64 Expiration = 0;
+	int32 Index = INDEX_NONE;
+
+	bool operator<(const FModerationExpiry& Other) const { return Expiration < Other.Expiration; }
+};
+
+// Indexes into Bans / ServerMutes, kept in array order so the first match wins like the old linear scan
+typedef TArray<int32, TInlineAllocator<1>> FModerationIndexList;
+
 // Old - Planned on being removed
 USTRUCT(BlueprintType)
 struct FBanInfo
@@ -166,6 +179,21 @@ public:
 	// Hot Reloading of Bans, Mutes, Whitelist Updates
 	void CheckForHotReload();
 
+	// Applies only the records appended since the last read, or reloads everything if the file was rewritten
+	void HotReloadBans();
+	void HotReloadMutes();
+	void HotReloadWhitelist();
+
+	// Rewrites any moderation list whose journal is mostly removed or superseded records
+	void CompactModerationJournals();
+
+	// Compact a moderation list once at least this many of its records are dead
+	UPROPERTY(config)
+	int32 ModerationJournalCompactRecords = 256;
+
+	// Times a full load and a delta reload of a generated ban list with NumEntries entries
+	FString BenchmarkModerationJournal(int32 NumEntries);
+
 	// Reserved Slots System
 	UPROPERTY(config)
 	int32 ReservedSlots = 20;
@@ -185,7 +213,6 @@ public:
 	static void TriggerWebHookFromContext(UObject* ConextObject, const FString& WebhookKey, TMap<FString, TSharedPtr<FJsonValue>> Properties);
 
 	void TriggerWebHook(const FString& WebhookKey, const TMap<FString, TSharedPtr<FJsonValue>>& Properties);
-	void TriggerWebHook_Callback(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString WebHookKey);
 
 	UFUNCTION(BlueprintCallable, Category = Webhook)
 	void TriggerWebHook(const UWebhook* Webhook);
@@ -800,6 +827,42 @@ protected:
 	TArray<FPlayerMute> ServerMutes;
 	TArray<FAlderonPlayerID> ServerWhitelist;
 
+	// Append-only files backing the lists above
+	FModerationJournal BansJournal = FModerationJournal(TEXT("bans.txt"));
+	FModerationJournal MutesJournal = FModerationJournal(TEXT("mutes.txt"));
+	FModerationJournal WhitelistJournal = FModerationJournal(TEXT("whitelist.txt"));
+
+	void LoadBanRecords(const TArray<FString>& Records);
+	int32 ApplyBanRecords(const TArray<FString>& Records);
+	int32 FindBanToRemove(const FString& RemovedEntry, const TSet<int32>& RemovedBans) const;
+	void KickBannedPlayers();
+
+	void LoadMuteRecords(const TArray<FString>& Records);
+	int32 ApplyMuteRecords(const TArray<FString>& Records);
+	int32 FindMuteToRemove(const FString& RemovedEntry, const TSet<int32>& RemovedMutes) const;
+	void RefreshServerMutedPlayers();
+
+	int32 ApplyWhitelistRecords(const TArray<FString>& Records, bool bUnique);
+
+	// Lookup indexes for Bans / ServerMutes keyed by Alderon Id display string and IP address
+	TMap<FString, FModerationIndexList> BanIdIndex;
+	TMap<FString, FModerationIndexList> BanIPIndex;
+	TMap<FString, FModerationIndexList> MuteIdIndex;
+
+	// Min-heaps of timed bans / mutes that are still present in the indexes
+	TArray<FModerationExpiry> BanExpiryHeap;
+	TArray<FModerationExpiry> MuteExpiryHeap;
+
+	void RebuildBanIndex();
+	void AddBanToIndex(int32 BanIndex);
+	void PruneExpiredBans();
+	const FPlayerBan* FindActiveBan(const FString& AlderonIdString);
+
+	void RebuildMuteIndex();
+	void AddMuteToIndex(int32 MuteIndex);
+	void PruneExpiredMutes();
+	const FPlayerMute* FindActiveMute(const FString& AlderonIdString);
+
 	// Old
 	UPROPERTY(Config)
 	TArray<FBanInfo> BannedUsers;
@@ -0,0 +1,80 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Append-only text journal backing a moderation list (bans.txt, mutes.txt, whitelist.txt).
+ * Each line is either an entry in the list's usual format or a removal record ("-<entry>") holding the
+ * removed entry's full line, so replay removes exactly that entry rather than the latest one with the same key.
+ * Older removal records hold only the key ("-<key>").
+ * Changes are appended, compaction rewrites the file with only the live entries.
+ * The read offset is remembered so hot reload only parses what was appended since the last read.
+ */
+class PATHOFTITANS_API FModerationJournal
+{
+public:
+	enum class EReadResult : uint8
+	{
+		// Nothing appended since the last read
+		Unchanged,
+		// Only the appended lines were returned
+		Delta,
+		// The file was rewritten or edited before the read offset, every line was returned
+		Full,
+		// The file could not be read
+		Missing
+	};
+
+	explicit FModerationJournal(const FString& InFileName);
+
+	FString GetFilePath() const;
+	bool Exists() const;
+
+	// Reads every line and moves the read offset to the end of the file
+	bool ReadAll(TArray<FString>& OutLines);
+
+	// Reads the lines appended since the last read
+	EReadResult ReadDelta(TArray<FString>& OutLines);
+
+	// Appends records to the end of the file without rewriting it
+	bool Append(const TArray<FString>& Records);
+	bool Append(const FString& Record);
+
+	// Rewrites the whole file, used for compaction
+	bool Rewrite(const TArray<FString>& Lines);
+
+	// Entry and removal records currently in the file
+	int32 GetNumRecords() const { return NumRecords; }
+
+	// True once enough of the file is removed or superseded records to be worth a rewrite
+	bool ShouldCompact(int32 NumLiveEntries, int32 MinDeadRecords) const;
+
+	static bool IsComment(const FString& Line);
+	static FString MakeRemovalRecord(const FString& Entry);
+	static bool ParseRemovalRecord(const FString& Line, FString& OutEntry);
+
+	// The Alderon Id or IP address an entry line starts with
+	static FString GetEntryKey(const FString& Entry);
+
+private:
+	bool ReadBytes(int64 Offset, TArray<uint8>& OutBytes) const;
+	void SetReadPosition(const TArray<uint8>& Bytes);
+	void RefreshReadPosition();
+	static int32 CountRecords(const TArray<FString>& Lines);
+
+	FString FileName;
+
+	// Byte offset of the end of the last read
+	int64 ReadOffset = 0;
+
+	// Checksum of every byte before ReadOffset, a mismatch means the file was edited rather than appended to
+	uint32 ReadChecksum = 0;
+	bool bEndsWithNewline = true;
+
+	// Legacy files written as UTF-16 can't be read from a byte offset, they are always fully reloaded until compacted
+	bool bLegacyEncoding = false;
+
+	int32 NumRecords = 0;
+};
@@ -0,0 +1,48 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Uniform 2D grid of player positions used for spawn point scoring.
+ * Positions are bucketed by XY cell, distances are still measured in 3D.
+ */
+struct PATHOFTITANS_API FPlayerPositionGrid
+{
+public:
+	explicit FPlayerPositionGrid(float InCellSize = 25000.0f);
+
+	void SetCellSize(float InCellSize);
+	float GetCellSize() const { return CellSize; }
+
+	void Reset();
+	void Add(const FVector& Position);
+
+	int32 Num() const { return NumPositions; }
+	bool IsEmpty() const { return NumPositions == 0; }
+
+	// Distance to the closest position, TNumericLimits<float>::Max() if the grid is empty
+	float FindNearestDistance(const FVector& Location) const;
+
+	// Number of positions within Radius of Location (inclusive)
+	int32 CountInRadius(const FVector& Location, float Radius) const;
+
+	// True if any position is within Radius of Location (inclusive)
+	bool AnyInRadius(const FVector& Location, float Radius) const;
+
+private:
+	FIntPoint GetCell(const FVector& Location) const;
+
+	template<typename FunctorType>
+	bool ForEachInRadius(const FVector& Location, float Radius, FunctorType&& Functor) const;
+
+	float CellSize = 25000.0f;
+	int32 NumPositions = 0;
+
+	// Bounds of occupied cells, used to stop ring searches early
+	FIntPoint MinCell = FIntPoint(MAX_int32, MAX_int32);
+	FIntPoint MaxCell = FIntPoint(MIN_int32, MIN_int32);
+
+	TMap<FIntPoint, TArray<FVector, TInlineAllocator<4>>> Cells;
+};
@@ -0,0 +1,169 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "HAL/Runnable.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "WebhookDispatcher.generated.h"
+
+class FJsonValue;
+class FEvent;
+
+typedef TMap<FString, TSharedPtr<FJsonValue>> FWebhookProperties;
+
+// Cached [ServerWebhooks] entry for one webhook key
+struct FWebhookEndpoint
+{
+	FString Url;
+	bool bDiscord = false;
+};
+
+// An event as queued by the game thread
+struct FWebhookEvent
+{
+	FString Key;
+	FString Username;
+	FWebhookEndpoint Endpoint;
+	FWebhookProperties Properties;
+	bool bWriteLogLine = true;
+};
+
+// A serialized request body covering one or more events of the same key
+struct FWebhookPayload
+{
+	FString Key;
+	FString Url;
+	FString Body;
+	int32 NumEvents = 0;
+	int32 NumAttempts = 0;
+};
+
+// Send state of one webhook key, requests for a key are sent one at a time in order
+struct FWebhookKeyState
+{
+	TArray<FWebhookPayload> Queue;
+	bool bInFlight = false;
+	double RetryAt = 0.0;
+	int32 ConsecutiveFailures = 0;
+};
+
+/**
+ * Formats webhook events off the game thread. Discord events of the same key arriving within the
+ * batch window are coalesced into one message with several embeds.
+ */
+class PATHOFTITANS_API FWebhookFormatWorker : public FRunnable
+{
+public:
+	explicit FWebhookFormatWorker(float InBatchWindowSeconds);
+	virtual ~FWebhookFormatWorker();
+
+	//FRunnable interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	void ShutDown();
+
+	void Enqueue(FWebhookEvent&& Event);
+	bool DequeuePayload(FWebhookPayload& OutPayload);
+
+	// Sends every open batch on the next pass regardless of the batch window
+	void RequestFlush();
+
+	// Events queued or batched that have not been turned into payloads yet
+	int32 GetNumPendingEvents() const { return PendingEvents.GetValue(); }
+
+private:
+	struct FPendingBatch
+	{
+		FString Url;
+		FString Username;
+		TArray<FString> Descriptions;
+		int32 NumCharacters = 0;
+		double FirstEventTime = 0.0;
+	};
+
+	void FormatEvent(FWebhookEvent& Event);
+	void FlushBatch(const FString& Key, FPendingBatch& Batch);
+
+	// Returns true if any batch is still open
+	bool FlushBatches(bool bForce);
+
+	TQueue<FWebhookEvent, EQueueMode::Mpsc> EventQueue;
+	TQueue<FWebhookPayload, EQueueMode::Spsc> PayloadQueue;
+
+	// Only touched by the worker thread
+	TMap<FString, FPendingBatch> Batches;
+
+	FThreadSafeCounter PendingEvents;
+	FThreadSafeCounter FlushRequested;
+	FThreadSafeCounter StopTaskCounter;
+
+	float BatchWindowSeconds = 1.0f;
+
+	FRunnableThread* Thread = nullptr;
+	FEvent* WorkEvent = nullptr;
+};
+
+/**
+ * Sends server webhooks without stalling the game thread. URLs are cached per key, payloads are
+ * formatted and batched on a worker, and each key is sent in order while honouring 429 Retry-After.
+ */
+UCLASS()
+class PATHOFTITANS_API UWebhookDispatcher : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	static UWebhookDispatcher* Get();
+
+	// Re-reads the [ServerWebhooks] section of the game ini
+	void ReloadConfig();
+
+	bool AreWebhooksEnabled() const { return bEnabled; }
+	const FWebhookEndpoint& GetEndpoint(const FString& Key);
+
+	void Dispatch(const FString& Key, const FString& Username, const FWebhookProperties& Properties);
+
+	// Blocks until every queued event has been formatted and delivered or TimeoutSeconds passes, returns true if nothing is left
+	bool Flush(float TimeoutSeconds = 5.0f);
+
+	// Pushes NumEvents through the formatter and sender against a local stand-in endpoint that rate limits every fifth request
+	FString BenchmarkThroughput(int32 NumEvents);
+
+private:
+	bool Tick(float DeltaTime);
+
+	bool HasPendingPayloads() const;
+
+	void SendNext(const FString& Key, FWebhookKeyState& State);
+	void OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString Key);
+	void HandleResponse(const FString& Key, int32 ResponseCode, float RetryAfterSeconds, float RateLimitResetSeconds);
+
+	bool bEnabled = false;
+	bool bDiscordFormat = false;
+	float BatchWindowSeconds = 1.0f;
+
+	TMap<FString, FWebhookEndpoint> Endpoints;
+	TMap<FString, FWebhookKeyState> KeyStates;
+
+	TUniquePtr<FWebhookFormatWorker> Worker;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	// Answers requests to the stand-in url instead of going over HTTP, returns the response code
+	TFunction<int32(const FWebhookPayload&, float& OutRetryAfterSeconds)> StandInTransport;
+
+	int32 NumRequestsSent = 0;
+	int32 NumRateLimited = 0;
+	int32 NumEventsDelivered = 0;
+	int32 NumEventsDropped = 0;
+
+	static UWebhookDispatcher* Instance;
+};